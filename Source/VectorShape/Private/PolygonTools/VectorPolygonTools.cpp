@@ -0,0 +1,2624 @@
+//==========================================================================//
+// Copyright Elhoussine Mehnik (ue4resources@gmail.com). All Rights Reserved.
+//================== http://unrealengineresources.com/ =====================//
+
+#include "PolygonTools/VectorPolygonTools.h"
+#include "VectorSplineComponent.h"
+#include "Algo/Reverse.h"
+#include "HAL/IConsoleManager.h"
+#include "Math/RandomStream.h"
+
+
+
+// Based off "Efficient Polygon Triangulation" algorithm by John W. Ratcliff (http://flipcode.net/archives/Efficient_Polygon_Triangulation.shtml)
+bool FPolygonTools::TriangulatePolygon(const TArray<FVector2D>& Polygon, TArray<uint32>& TriangulatedIndices, int32 StartVertex, bool bAllowSimpleTriangulation)
+{
+	int32 NumVertices = Polygon.Num();
+	if (NumVertices < 3)
+	{
+		return false;
+	}
+
+	if (bAllowSimpleTriangulation && IsPolygonConvex(Polygon))
+	{
+		return TriangulateSimplePolygon(TriangulatedIndices, NumVertices, StartVertex);
+	}
+
+	// Allocate and initialize a list of vertex indices for the new polygon
+	TArray<int32> TempIndices;
+	TempIndices.SetNumUninitialized(NumVertices);
+	int32* VertexIndices = TempIndices.GetData();
+	for (int32 PointIndex = 0; PointIndex < NumVertices; PointIndex++)
+	{
+		VertexIndices[PointIndex] = PointIndex;
+	}
+
+	return ClipEars(Polygon, TempIndices, nullptr, TriangulatedIndices, StartVertex);
+}
+
+bool FPolygonTools::ClipEars(const TArray<FVector2D>& Points, TArray<int32>& TempIndices, const uint32* SourceIndices, TArray<uint32>& TriangulatedIndices, int32 StartVertex)
+{
+	int32 NumVertices = TempIndices.Num();
+	int32* VertexIndices = TempIndices.GetData();
+
+	// Remove NumVertices-2 vertices, creating one triangle every time 
+	int32 ErrorDetectionCounter = 2 * NumVertices;
+	for (int32 V = NumVertices - 1; NumVertices > 2; )
+	{
+		// If we loop, it is probably a non-simple polygon
+		if (--ErrorDetectionCounter <= 0)
+		{
+			// Bad polygon!  This can happen if there are adjacent points that are exactly overlapping
+			return false;
+		}
+
+		// Three consecutive vertices in current polygon, <u,v,w>
+		const int32 U = (V < NumVertices) ? V : 0;
+		V = ((U + 1) < NumVertices) ? U + 1 : 0;
+		const int32 W = ((V + 1) < NumVertices) ? V + 1 : 0;
+
+		if (Snip(Points, U, V, W, NumVertices, VertexIndices))
+		{
+			// Output triangle as indices into the original polygon array
+			if (SourceIndices != nullptr)
+			{
+				TriangulatedIndices.Add(StartVertex + SourceIndices[VertexIndices[W]]);
+				TriangulatedIndices.Add(StartVertex + SourceIndices[VertexIndices[V]]);
+				TriangulatedIndices.Add(StartVertex + SourceIndices[VertexIndices[U]]);
+			}
+			else
+			{
+				TriangulatedIndices.Add(StartVertex + VertexIndices[W]);
+				TriangulatedIndices.Add(StartVertex + VertexIndices[V]);
+				TriangulatedIndices.Add(StartVertex + VertexIndices[U]);
+			}
+
+			/* Remove V from remaining polygon */
+			for (int32 S = V, T = V + 1; T < NumVertices; S++, T++)
+			{
+				VertexIndices[S] = VertexIndices[T];
+			}
+			NumVertices--;
+
+			// Reset error detection counter
+			ErrorDetectionCounter = 2 * NumVertices;
+		}
+	}
+
+	return true;
+}
+
+bool FPolygonTools::TriangulatePolygon(const TArray<FVector2D>& Polygon, TArray<uint32>& TriangulatedIndices, int32 StartVertex, EVectorTriangulationMethod Method)
+{
+	switch (Method)
+	{
+	case EVectorTriangulationMethod::MonotoneSweep:
+		return TriangulateMonotonePolygon(Polygon, TriangulatedIndices, StartVertex);
+
+	case EVectorTriangulationMethod::IndexedEarClipping:
+	{
+		if (Polygon.Num() < 3)
+		{
+			return false;
+		}
+
+		TArray<int32> Contour;
+		Contour.SetNumUninitialized(Polygon.Num());
+		for (int32 PointIndex = 0; PointIndex < Polygon.Num(); PointIndex++)
+		{
+			Contour[PointIndex] = PointIndex;
+		}
+		return ClipEarsIndexed(Polygon, Contour, nullptr, TriangulatedIndices, StartVertex);
+	}
+
+	case EVectorTriangulationMethod::EarClipping:
+	default:
+		return TriangulatePolygon(Polygon, TriangulatedIndices, StartVertex, false);
+	}
+}
+
+
+namespace PolygonLoops
+{
+	/** Twice the signed area of ABC, positive when counter-clockwise. */
+	static FORCEINLINE double Orient(const FVector2D& A, const FVector2D& B, const FVector2D& C)
+	{
+		return ((B.X - A.X) * (C.Y - A.Y)) - ((B.Y - A.Y) * (C.X - A.X));
+	}
+
+	/**
+	 * One or more closed boundary loops packed in a single point array. Every loop is stored with the
+	 * interior on its left : the outer contour counter-clockwise, holes clockwise.
+	 */
+	struct FPolygonLoops
+	{
+		TArray<FVector2D> Points;
+		TArray<int32> Next;
+		TArray<int32> Prev;
+		/** Index of each point in the caller's vertex layout (outer contour first, then each hole). */
+		TArray<uint32> SourceIndices;
+		/** First point of each loop. */
+		TArray<int32> LoopStarts;
+
+		void Reserve(int32 NumPoints)
+		{
+			Points.Reserve(NumPoints);
+			Next.Reserve(NumPoints);
+			Prev.Reserve(NumPoints);
+			SourceIndices.Reserve(NumPoints);
+		}
+
+		void AddLoop(const TArray<FVector2D>& Loop, bool bCounterClockwise, uint32 FirstSourceIndex)
+		{
+			const int32 NumLoopPoints = Loop.Num();
+			const int32 First = Points.Num();
+			const bool bIsReversed = (FPolygonTools::Area(Loop) > 0.0f) != bCounterClockwise;
+
+			LoopStarts.Add(First);
+			for (int32 LoopIdx = 0; LoopIdx < NumLoopPoints; LoopIdx++)
+			{
+				const int32 SourceIdx = bIsReversed ? (NumLoopPoints - 1 - LoopIdx) : LoopIdx;
+				Points.Add(Loop[SourceIdx]);
+				SourceIndices.Add(FirstSourceIndex + SourceIdx);
+				Next.Add(First + (LoopIdx + 1) % NumLoopPoints);
+				Prev.Add(First + (LoopIdx + NumLoopPoints - 1) % NumLoopPoints);
+			}
+		}
+
+		int32 Num() const
+		{
+			return Points.Num();
+		}
+	};
+}
+
+
+namespace MonotoneTriangulation
+{
+	using PolygonLoops::Orient;
+
+	enum class EVertexType : uint8
+	{
+		Start,
+		End,
+		Split,
+		Merge,
+		RegularLeft,
+		RegularRight
+	};
+
+	/** Sweep order : higher Y first, lower X first on ties. */
+	static FORCEINLINE bool IsAbove(const FVector2D& A, const FVector2D& B)
+	{
+		return (A.Y > B.Y) || (A.Y == B.Y && A.X < B.X);
+	}
+
+	/** Sweep status : left boundary edges crossing the sweep line, kept sorted by X. */
+	struct FSweepStatus
+	{
+		const PolygonLoops::FPolygonLoops& Loops;
+		TArray<int32> Edges;
+
+		FSweepStatus(const PolygonLoops::FPolygonLoops& InLoops)
+			: Loops(InLoops)
+		{
+			Edges.Reserve(InLoops.Num() / 2 + 1);
+		}
+
+		/** X coordinate of edge (EdgeIndex, Next[EdgeIndex]) at the height of Point. */
+		double EdgeX(int32 EdgeIndex, const FVector2D& Point) const
+		{
+			const FVector2D& A = Loops.Points[EdgeIndex];
+			const FVector2D& B = Loops.Points[Loops.Next[EdgeIndex]];
+			const double DeltaY = B.Y - A.Y;
+			if (FMath::Abs(DeltaY) <= SMALL_NUMBER)
+			{
+				return FMath::Clamp<double>(Point.X, FMath::Min<double>(A.X, B.X), FMath::Max<double>(A.X, B.X));
+			}
+			return A.X + (Point.Y - A.Y) * (B.X - A.X) / DeltaY;
+		}
+
+		/** Index of the first edge whose X at Point is greater than (or equal when bInclusive is false) Point.X. */
+		int32 UpperBound(const FVector2D& Point, bool bInclusive) const
+		{
+			int32 Low = 0;
+			int32 High = Edges.Num();
+			while (Low < High)
+			{
+				const int32 Mid = (Low + High) / 2;
+				const double X = EdgeX(Edges[Mid], Point);
+				if (bInclusive ? (X <= Point.X) : (X < Point.X))
+				{
+					Low = Mid + 1;
+				}
+				else
+				{
+					High = Mid;
+				}
+			}
+			return Low;
+		}
+
+		void Insert(int32 EdgeIndex, const FVector2D& Point)
+		{
+			Edges.Insert(EdgeIndex, UpperBound(Point, true));
+		}
+
+		void Remove(int32 EdgeIndex, const FVector2D& Point)
+		{
+			int32 Position = UpperBound(Point, false);
+			while (Position < Edges.Num() && Edges[Position] != EdgeIndex)
+			{
+				Position++;
+			}
+
+			if (Position == Edges.Num())
+			{
+				Position = Edges.Find(EdgeIndex);
+			}
+
+			if (Position != INDEX_NONE)
+			{
+				Edges.RemoveAt(Position, 1, false);
+			}
+		}
+
+		/** Edge directly to the left of Point, or INDEX_NONE. */
+		int32 FindLeft(const FVector2D& Point) const
+		{
+			const int32 Position = UpperBound(Point, true) - 1;
+			return Edges.IsValidIndex(Position) ? Edges[Position] : INDEX_NONE;
+		}
+	};
+
+	static bool Triangulate(const PolygonLoops::FPolygonLoops& Loops, TArray<uint32>& TriangulatedIndices, int32 StartVertex)
+	{
+		const TArray<FVector2D>& Points = Loops.Points;
+		const int32 NumVertices = Loops.Num();
+
+		// Classify vertices
+		TArray<EVertexType> VertexTypes;
+		VertexTypes.SetNumUninitialized(NumVertices);
+		for (int32 V = 0; V < NumVertices; V++)
+		{
+			const FVector2D& Prev = Points[Loops.Prev[V]];
+			const FVector2D& Curr = Points[V];
+			const FVector2D& Next = Points[Loops.Next[V]];
+
+			const bool bPrevBelow = IsAbove(Curr, Prev);
+			const bool bNextBelow = IsAbove(Curr, Next);
+			const bool bIsConvex = Orient(Prev, Curr, Next) > 0.0;
+
+			if (bPrevBelow && bNextBelow)
+			{
+				VertexTypes[V] = bIsConvex ? EVertexType::Start : EVertexType::Split;
+			}
+			else if (!bPrevBelow && !bNextBelow)
+			{
+				VertexTypes[V] = bIsConvex ? EVertexType::End : EVertexType::Merge;
+			}
+			else
+			{
+				// Going down along the boundary means the interior lies to the right
+				VertexTypes[V] = bNextBelow ? EVertexType::RegularLeft : EVertexType::RegularRight;
+			}
+		}
+
+		TArray<int32> SweepOrder;
+		SweepOrder.SetNumUninitialized(NumVertices);
+		for (int32 V = 0; V < NumVertices; V++)
+		{
+			SweepOrder[V] = V;
+		}
+		SweepOrder.Sort([&Points](int32 A, int32 B) { return IsAbove(Points[A], Points[B]); });
+
+		// Partition into y-monotone pieces
+		TArray<FIntPoint> Diagonals;
+		TArray<int32> EdgeHelpers;
+		EdgeHelpers.Init(INDEX_NONE, NumVertices);
+		FSweepStatus Status(Loops);
+
+		auto ConnectToMergeHelper = [&](int32 V, int32 EdgeIndex)
+		{
+			if (EdgeIndex != INDEX_NONE && EdgeHelpers[EdgeIndex] != INDEX_NONE && VertexTypes[EdgeHelpers[EdgeIndex]] == EVertexType::Merge)
+			{
+				Diagonals.Add(FIntPoint(V, EdgeHelpers[EdgeIndex]));
+			}
+		};
+
+		for (int32 V : SweepOrder)
+		{
+			const int32 PrevEdge = Loops.Prev[V];
+			const FVector2D& Point = Points[V];
+
+			switch (VertexTypes[V])
+			{
+			case EVertexType::Start:
+				Status.Insert(V, Point);
+				EdgeHelpers[V] = V;
+				break;
+
+			case EVertexType::End:
+				ConnectToMergeHelper(V, PrevEdge);
+				Status.Remove(PrevEdge, Point);
+				break;
+
+			case EVertexType::Split:
+			{
+				const int32 LeftEdge = Status.FindLeft(Point);
+				if (LeftEdge == INDEX_NONE)
+				{
+					return false;
+				}
+				Diagonals.Add(FIntPoint(V, EdgeHelpers[LeftEdge]));
+				EdgeHelpers[LeftEdge] = V;
+				Status.Insert(V, Point);
+				EdgeHelpers[V] = V;
+				break;
+			}
+
+			case EVertexType::Merge:
+			{
+				ConnectToMergeHelper(V, PrevEdge);
+				Status.Remove(PrevEdge, Point);
+				const int32 LeftEdge = Status.FindLeft(Point);
+				if (LeftEdge == INDEX_NONE)
+				{
+					return false;
+				}
+				ConnectToMergeHelper(V, LeftEdge);
+				EdgeHelpers[LeftEdge] = V;
+				break;
+			}
+
+			case EVertexType::RegularLeft:
+				ConnectToMergeHelper(V, PrevEdge);
+				Status.Remove(PrevEdge, Point);
+				Status.Insert(V, Point);
+				EdgeHelpers[V] = V;
+				break;
+
+			case EVertexType::RegularRight:
+			{
+				const int32 LeftEdge = Status.FindLeft(Point);
+				if (LeftEdge == INDEX_NONE)
+				{
+					return false;
+				}
+				ConnectToMergeHelper(V, LeftEdge);
+				EdgeHelpers[LeftEdge] = V;
+				break;
+			}
+			}
+		}
+
+		// Build outgoing half-edges per vertex : boundary edges plus both directions of every diagonal
+		const int32 NumHalfEdges = NumVertices + Diagonals.Num() * 2;
+		TArray<int32> HalfEdgeFrom;
+		TArray<int32> HalfEdgeTo;
+		HalfEdgeFrom.Reserve(NumHalfEdges);
+		HalfEdgeTo.Reserve(NumHalfEdges);
+		for (int32 V = 0; V < NumVertices; V++)
+		{
+			HalfEdgeFrom.Add(V);
+			HalfEdgeTo.Add(Loops.Next[V]);
+		}
+		for (const FIntPoint& Diagonal : Diagonals)
+		{
+			HalfEdgeFrom.Add(Diagonal.X);
+			HalfEdgeTo.Add(Diagonal.Y);
+			HalfEdgeFrom.Add(Diagonal.Y);
+			HalfEdgeTo.Add(Diagonal.X);
+		}
+
+		TArray<int32> OutgoingOffsets;
+		OutgoingOffsets.Init(0, NumVertices + 1);
+		for (int32 HalfEdge = 0; HalfEdge < NumHalfEdges; HalfEdge++)
+		{
+			OutgoingOffsets[HalfEdgeFrom[HalfEdge] + 1]++;
+		}
+		for (int32 V = 0; V < NumVertices; V++)
+		{
+			OutgoingOffsets[V + 1] += OutgoingOffsets[V];
+		}
+
+		TArray<int32> Outgoing;
+		Outgoing.SetNumUninitialized(NumHalfEdges);
+		{
+			TArray<int32> Cursor(OutgoingOffsets.GetData(), NumVertices);
+			for (int32 HalfEdge = 0; HalfEdge < NumHalfEdges; HalfEdge++)
+			{
+				Outgoing[Cursor[HalfEdgeFrom[HalfEdge]]++] = HalfEdge;
+			}
+		}
+
+		// Next half-edge around the face on the left : the first outgoing edge clockwise from the way back
+		auto NextHalfEdge = [&](int32 HalfEdge) -> int32
+		{
+			const int32 From = HalfEdgeFrom[HalfEdge];
+			const int32 To = HalfEdgeTo[HalfEdge];
+			const FVector2D BackDirection = Points[From] - Points[To];
+			const double BackAngle = FMath::Atan2(BackDirection.Y, BackDirection.X);
+
+			int32 BestHalfEdge = INDEX_NONE;
+			double BestDelta = TNumericLimits<double>::Max();
+			for (int32 OutIdx = OutgoingOffsets[To]; OutIdx < OutgoingOffsets[To + 1]; OutIdx++)
+			{
+				const int32 Candidate = Outgoing[OutIdx];
+				const FVector2D Direction = Points[HalfEdgeTo[Candidate]] - Points[To];
+				double Delta = BackAngle - FMath::Atan2(Direction.Y, Direction.X);
+				while (Delta <= 0.0)
+				{
+					Delta += 2.0 * PI;
+				}
+				if (Delta < BestDelta)
+				{
+					BestDelta = Delta;
+					BestHalfEdge = Candidate;
+				}
+			}
+			return BestHalfEdge;
+		};
+
+		const int32 NumIndicesBefore = TriangulatedIndices.Num();
+		TriangulatedIndices.Reserve(NumIndicesBefore + NumVertices * 3);
+
+		auto EmitTriangle = [&](int32 A, int32 B, int32 C)
+		{
+			const double Orientation = Orient(Points[A], Points[B], Points[C]);
+			if (Orientation == 0.0)
+			{
+				return;
+			}
+
+			// Same winding as the ear clipping output
+			if (Orientation > 0.0)
+			{
+				Swap(A, C);
+			}
+			TriangulatedIndices.Add(StartVertex + Loops.SourceIndices[A]);
+			TriangulatedIndices.Add(StartVertex + Loops.SourceIndices[B]);
+			TriangulatedIndices.Add(StartVertex + Loops.SourceIndices[C]);
+		};
+
+		// Triangulate each monotone piece
+		TArray<bool> VisitedHalfEdges;
+		VisitedHalfEdges.Init(false, NumHalfEdges);
+		TArray<bool> IsOnLeftChain;
+		IsOnLeftChain.Init(false, NumVertices);
+		TArray<int32> Face;
+		TArray<int32> Stack;
+
+		for (int32 FirstHalfEdge = 0; FirstHalfEdge < NumHalfEdges; FirstHalfEdge++)
+		{
+			if (VisitedHalfEdges[FirstHalfEdge])
+			{
+				continue;
+			}
+
+			Face.Reset();
+			int32 HalfEdge = FirstHalfEdge;
+			do
+			{
+				if (HalfEdge == INDEX_NONE || VisitedHalfEdges[HalfEdge] || Face.Num() > NumVertices)
+				{
+					// Inconsistent partition, most likely a self-intersecting polygon
+					TriangulatedIndices.SetNum(NumIndicesBefore, false);
+					return false;
+				}
+				VisitedHalfEdges[HalfEdge] = true;
+				Face.Add(HalfEdgeFrom[HalfEdge]);
+				HalfEdge = NextHalfEdge(HalfEdge);
+			} while (HalfEdge != FirstHalfEdge);
+
+			const int32 FaceSize = Face.Num();
+			if (FaceSize < 3)
+			{
+				continue;
+			}
+
+			if (FaceSize == 3)
+			{
+				EmitTriangle(Face[0], Face[1], Face[2]);
+				continue;
+			}
+
+			// Split the piece into its left and right chains
+			int32 TopIdx = 0;
+			int32 BottomIdx = 0;
+			for (int32 FaceIdx = 1; FaceIdx < FaceSize; FaceIdx++)
+			{
+				if (IsAbove(Points[Face[FaceIdx]], Points[Face[TopIdx]]))
+				{
+					TopIdx = FaceIdx;
+				}
+				if (IsAbove(Points[Face[BottomIdx]], Points[Face[FaceIdx]]))
+				{
+					BottomIdx = FaceIdx;
+				}
+			}
+
+			for (int32 FaceIdx = TopIdx; FaceIdx != BottomIdx; FaceIdx = (FaceIdx + 1) % FaceSize)
+			{
+				IsOnLeftChain[Face[FaceIdx]] = true;
+			}
+			for (int32 FaceIdx = BottomIdx; FaceIdx != TopIdx; FaceIdx = (FaceIdx + 1) % FaceSize)
+			{
+				IsOnLeftChain[Face[FaceIdx]] = false;
+			}
+
+			Face.Sort([&Points](int32 A, int32 B) { return IsAbove(Points[A], Points[B]); });
+
+			Stack.Reset();
+			Stack.Add(Face[0]);
+			Stack.Add(Face[1]);
+
+			for (int32 FaceIdx = 2; FaceIdx < FaceSize - 1; FaceIdx++)
+			{
+				const int32 V = Face[FaceIdx];
+
+				if (IsOnLeftChain[V] != IsOnLeftChain[Stack.Last()])
+				{
+					// Opposite chain : fan out to the whole stack
+					for (int32 StackIdx = Stack.Num() - 1; StackIdx > 0; StackIdx--)
+					{
+						EmitTriangle(V, Stack[StackIdx], Stack[StackIdx - 1]);
+					}
+					Stack.Reset();
+					Stack.Add(Face[FaceIdx - 1]);
+					Stack.Add(V);
+				}
+				else
+				{
+					// Same chain : cut off every vertex that is visible from V
+					int32 LastPopped = Stack.Pop(false);
+					while (Stack.Num() > 0)
+					{
+						const double Orientation = Orient(Points[V], Points[LastPopped], Points[Stack.Last()]);
+						const bool bIsInside = IsOnLeftChain[V] ? (Orientation < 0.0) : (Orientation > 0.0);
+						if (!bIsInside)
+						{
+							break;
+						}
+
+						EmitTriangle(V, LastPopped, Stack.Last());
+						LastPopped = Stack.Pop(false);
+					}
+					Stack.Add(LastPopped);
+					Stack.Add(V);
+				}
+			}
+
+			const int32 Bottom = Face[FaceSize - 1];
+			for (int32 StackIdx = Stack.Num() - 1; StackIdx > 0; StackIdx--)
+			{
+				EmitTriangle(Bottom, Stack[StackIdx], Stack[StackIdx - 1]);
+			}
+		}
+
+		return TriangulatedIndices.Num() > NumIndicesBefore;
+	}
+}
+
+bool FPolygonTools::TriangulateMonotonePolygon(const TArray<FVector2D>& Polygon, TArray<uint32>& TriangulatedIndices, int32 StartVertex)
+{
+	if (Polygon.Num() < 3)
+	{
+		return false;
+	}
+
+	PolygonLoops::FPolygonLoops Loops;
+	Loops.Reserve(Polygon.Num());
+	Loops.AddLoop(Polygon, true, 0);
+
+	return MonotoneTriangulation::Triangulate(Loops, TriangulatedIndices, StartVertex);
+}
+
+
+namespace HoleBridging
+{
+	using PolygonLoops::Orient;
+
+	/** Whether Point lies in the interior wedge of the merged contour at Contour[Position]. */
+	static bool IsLocallyInside(const PolygonLoops::FPolygonLoops& Loops, const TArray<int32>& Contour, int32 Position, const FVector2D& Point)
+	{
+		const int32 NumContour = Contour.Num();
+		const FVector2D& A = Loops.Points[Contour[(Position + NumContour - 1) % NumContour]];
+		const FVector2D& P = Loops.Points[Contour[Position]];
+		const FVector2D& B = Loops.Points[Contour[(Position + 1) % NumContour]];
+
+		if (Orient(A, P, B) >= 0.0)
+		{
+			return Orient(P, B, Point) >= 0.0 && Orient(P, Point, A) >= 0.0;
+		}
+		return !(Orient(P, A, Point) > 0.0 && Orient(P, B, Point) < 0.0);
+	}
+
+	/** Position in Contour of a vertex visible from HolePoint, found by casting a ray towards +X (Eberly). */
+	static int32 FindBridge(const PolygonLoops::FPolygonLoops& Loops, const TArray<int32>& Contour, const FVector2D& HolePoint)
+	{
+		const int32 NumContour = Contour.Num();
+		const TArray<FVector2D>& Points = Loops.Points;
+
+		// Closest edge hit by the ray, walking up the right side of the interior
+		int32 BestPosition = INDEX_NONE;
+		double BestX = TNumericLimits<double>::Max();
+		for (int32 Position = 0; Position < NumContour; Position++)
+		{
+			const FVector2D& A = Points[Contour[Position]];
+			const FVector2D& B = Points[Contour[(Position + 1) % NumContour]];
+			if (A.Y <= HolePoint.Y && B.Y >= HolePoint.Y && A.Y != B.Y)
+			{
+				const double X = A.X + (HolePoint.Y - A.Y) * (B.X - A.X) / (B.Y - A.Y);
+				if (X >= HolePoint.X && X < BestX)
+				{
+					BestX = X;
+					BestPosition = (A.X > B.X) ? Position : (Position + 1) % NumContour;
+					if (A.Y == HolePoint.Y)
+					{
+						BestPosition = Position;
+					}
+					else if (B.Y == HolePoint.Y)
+					{
+						BestPosition = (Position + 1) % NumContour;
+					}
+				}
+			}
+		}
+
+		if (BestPosition == INDEX_NONE)
+		{
+			return INDEX_NONE;
+		}
+
+		const FVector2D Hit(BestX, HolePoint.Y);
+		const FVector2D Candidate = Points[Contour[BestPosition]];
+		if (Candidate == Hit)
+		{
+			return BestPosition;
+		}
+
+		// A vertex inside the triangle (HolePoint, Hit, Candidate) would block the bridge : take the one with the smallest angle to the ray
+		const bool bIsCCW = Orient(HolePoint, Hit, Candidate) > 0.0;
+		const FVector2D& T0 = HolePoint;
+		const FVector2D& T1 = bIsCCW ? Hit : Candidate;
+		const FVector2D& T2 = bIsCCW ? Candidate : Hit;
+
+		double BestTan = TNumericLimits<double>::Max();
+		double BestDistance = TNumericLimits<double>::Max();
+		for (int32 Position = 0; Position < NumContour; Position++)
+		{
+			const FVector2D& Point = Points[Contour[Position]];
+			if (Point.X < HolePoint.X || Point == Candidate)
+			{
+				continue;
+			}
+
+			if (Orient(T0, T1, Point) >= 0.0 && Orient(T1, T2, Point) >= 0.0 && Orient(T2, T0, Point) >= 0.0 && IsLocallyInside(Loops, Contour, Position, HolePoint))
+			{
+				const double DeltaX = Point.X - HolePoint.X;
+				const double Tan = (DeltaX > 0.0) ? FMath::Abs(Point.Y - HolePoint.Y) / DeltaX : TNumericLimits<double>::Max();
+				const double Distance = FVector2D::DistSquared(Point, HolePoint);
+				if (Tan < BestTan || (Tan == BestTan && Distance < BestDistance))
+				{
+					BestTan = Tan;
+					BestDistance = Distance;
+					BestPosition = Position;
+				}
+			}
+		}
+
+		// When several holes were bridged to the same vertex, pick the occurrence whose wedge faces the hole
+		const int32 BridgeVertex = Contour[BestPosition];
+		for (int32 Position = 0; Position < NumContour; Position++)
+		{
+			if (Contour[Position] == BridgeVertex && IsLocallyInside(Loops, Contour, Position, HolePoint))
+			{
+				return Position;
+			}
+		}
+
+		return BestPosition;
+	}
+
+	/** Splice every hole loop into the outer loop, producing a single weakly simple contour of loop indices. */
+	static bool Bridge(const PolygonLoops::FPolygonLoops& Loops, TArray<int32>& OutContour)
+	{
+		const int32 NumLoops = Loops.LoopStarts.Num();
+		const int32 OuterEnd = (NumLoops > 1) ? Loops.LoopStarts[1] : Loops.Num();
+
+		OutContour.Reset(Loops.Num() + (NumLoops - 1) * 2);
+		for (int32 V = 0; V < OuterEnd; V++)
+		{
+			OutContour.Add(V);
+		}
+
+		// Rightmost vertex of every hole, holes further right are bridged first
+		TArray<int32> HoleRightmost;
+		for (int32 LoopIdx = 1; LoopIdx < NumLoops; LoopIdx++)
+		{
+			const int32 LoopStart = Loops.LoopStarts[LoopIdx];
+			const int32 LoopEnd = (LoopIdx + 1 < NumLoops) ? Loops.LoopStarts[LoopIdx + 1] : Loops.Num();
+			int32 Rightmost = LoopStart;
+			for (int32 V = LoopStart + 1; V < LoopEnd; V++)
+			{
+				const FVector2D& Point = Loops.Points[V];
+				const FVector2D& Best = Loops.Points[Rightmost];
+				if (Point.X > Best.X || (Point.X == Best.X && Point.Y < Best.Y))
+				{
+					Rightmost = V;
+				}
+			}
+			HoleRightmost.Add(Rightmost);
+		}
+		HoleRightmost.Sort([&Loops](int32 A, int32 B) { return Loops.Points[A].X > Loops.Points[B].X; });
+
+		TArray<int32> HoleContour;
+		for (int32 HoleStart : HoleRightmost)
+		{
+			const int32 BridgePosition = FindBridge(Loops, OutContour, Loops.Points[HoleStart]);
+			if (BridgePosition == INDEX_NONE)
+			{
+				return false;
+			}
+
+			// ... Bridge, HoleStart, hole loop ..., HoleStart, Bridge ...
+			HoleContour.Reset();
+			int32 V = HoleStart;
+			do
+			{
+				HoleContour.Add(V);
+				V = Loops.Next[V];
+			} while (V != HoleStart);
+			HoleContour.Add(HoleStart);
+			HoleContour.Add(OutContour[BridgePosition]);
+
+			OutContour.Insert(HoleContour, BridgePosition + 1);
+		}
+
+		return true;
+	}
+}
+
+// Ear clipping after "Triangulation by Ear Clipping" by David Eberly : only reflex vertices can lie inside an ear, and clipping an ear only changes the ear state of its neighbours
+namespace IndexedEarClipping
+{
+	struct FNode
+	{
+		/** Index into the points. */
+		int32 Point;
+		int32 Prev;
+		int32 Next;
+		bool bIsReflex;
+		bool bIsEar;
+		bool bIsRemoved;
+	};
+
+	/** Uniform grid over the polygon bounds, bucketing the initially reflex vertices. Vertices turning convex stay in their cell and are skipped. */
+	struct FReflexGrid
+	{
+		FVector2D MinPoint;
+		FVector2D InvCellSize;
+		int32 NumCellsX;
+		int32 NumCellsY;
+		/** Nodes of each cell, packed : cell C owns CellNodes[CellStarts[C], CellStarts[C + 1]). */
+		TArray<int32> CellStarts;
+		TArray<int32> CellNodes;
+
+		FORCEINLINE int32 GetCellX(double X) const
+		{
+			return FMath::Clamp((int32)((X - MinPoint.X) * InvCellSize.X), 0, NumCellsX - 1);
+		}
+
+		FORCEINLINE int32 GetCellY(double Y) const
+		{
+			return FMath::Clamp((int32)((Y - MinPoint.Y) * InvCellSize.Y), 0, NumCellsY - 1);
+		}
+	};
+
+	class FTriangulator
+	{
+	public:
+
+		FTriangulator(const TArray<FVector2D>& InPoints, const TArray<int32>& Contour)
+			: Points(InPoints)
+		{
+			const int32 NumNodes = Contour.Num();
+			Nodes.SetNumUninitialized(NumNodes);
+
+			FBox2D Bounds(ForceInit);
+			for (int32 NodeIdx = 0; NodeIdx < NumNodes; NodeIdx++)
+			{
+				FNode& Node = Nodes[NodeIdx];
+				Node.Point = Contour[NodeIdx];
+				Node.Prev = (NodeIdx + NumNodes - 1) % NumNodes;
+				Node.Next = (NodeIdx + 1) % NumNodes;
+				Node.bIsEar = false;
+				Node.bIsRemoved = false;
+				Bounds += Points[Node.Point];
+			}
+
+			int32 NumReflex = 0;
+			for (int32 NodeIdx = 0; NodeIdx < NumNodes; NodeIdx++)
+			{
+				Nodes[NodeIdx].bIsReflex = IsReflex(NodeIdx);
+				NumReflex += Nodes[NodeIdx].bIsReflex ? 1 : 0;
+			}
+
+			BuildGrid(Bounds, NumReflex);
+		}
+
+		/** Clips the ears of the contour, returns false if it runs out of ears before the polygon is fully triangulated. */
+		bool Triangulate(const uint32* SourceIndices, TArray<uint32>& TriangulatedIndices, int32 StartVertex)
+		{
+			const int32 NumNodes = Nodes.Num();
+
+			TArray<int32> Ears;
+			Ears.Reserve(NumNodes);
+			for (int32 NodeIdx = NumNodes - 1; NodeIdx >= 0; NodeIdx--)
+			{
+				Nodes[NodeIdx].bIsEar = IsEar(NodeIdx);
+				if (Nodes[NodeIdx].bIsEar)
+				{
+					Ears.Add(NodeIdx);
+				}
+			}
+
+			for (int32 NumRemaining = NumNodes; NumRemaining > 2; )
+			{
+				if (Ears.Num() == 0)
+				{
+					return false;
+				}
+
+				const int32 Ear = Ears.Pop(false);
+				FNode& EarNode = Nodes[Ear];
+				if (EarNode.bIsRemoved || !EarNode.bIsEar)
+				{
+					continue;
+				}
+
+				const int32 Prev = EarNode.Prev;
+				const int32 Next = EarNode.Next;
+
+				// Same winding as ClipEars
+				const int32 Triangle[3] = { Next, Ear, Prev };
+				for (int32 Corner : Triangle)
+				{
+					const int32 PointIdx = Nodes[Corner].Point;
+					TriangulatedIndices.Add(StartVertex + (SourceIndices != nullptr ? SourceIndices[PointIdx] : PointIdx));
+				}
+
+				Nodes[Prev].Next = Next;
+				Nodes[Next].Prev = Prev;
+				EarNode.bIsRemoved = true;
+				NumRemaining--;
+
+				// Neighbours only get more convex. A vertex turning convex could not unblock any ear, as a reflex one would still lie inside it.
+				for (int32 Neighbour : { Prev, Next })
+				{
+					FNode& NeighbourNode = Nodes[Neighbour];
+					NeighbourNode.bIsReflex = NeighbourNode.bIsReflex && IsReflex(Neighbour);
+					NeighbourNode.bIsEar = IsEar(Neighbour);
+				}
+
+				if (Nodes[Next].bIsEar)
+				{
+					Ears.Add(Next);
+				}
+				if (Nodes[Prev].bIsEar)
+				{
+					Ears.Add(Prev);
+				}
+			}
+
+			return true;
+		}
+
+	private:
+
+		void BuildGrid(const FBox2D& Bounds, int32 NumReflex)
+		{
+			// About one reflex vertex per square cell
+			const FVector2D Size(FMath::Max(Bounds.Max.X - Bounds.Min.X, UE_DOUBLE_KINDA_SMALL_NUMBER), FMath::Max(Bounds.Max.Y - Bounds.Min.Y, UE_DOUBLE_KINDA_SMALL_NUMBER));
+			const double CellSize = FMath::Sqrt(Size.X * Size.Y / FMath::Max(NumReflex, 1));
+
+			Grid.MinPoint = Bounds.Min;
+			Grid.NumCellsX = FMath::Clamp(FMath::CeilToInt32(Size.X / CellSize), 1, MaxCellsPerAxis);
+			Grid.NumCellsY = FMath::Clamp(FMath::CeilToInt32(Size.Y / CellSize), 1, MaxCellsPerAxis);
+			Grid.InvCellSize = FVector2D(Grid.NumCellsX / Size.X, Grid.NumCellsY / Size.Y);
+
+			// Counting sort of the reflex vertices by cell
+			const int32 NumCells = Grid.NumCellsX * Grid.NumCellsY;
+			Grid.CellStarts.SetNumZeroed(NumCells + 1);
+			Grid.CellNodes.SetNumUninitialized(NumReflex);
+
+			auto GetCell = [this](int32 NodeIdx)
+			{
+				const FVector2D& Point = GetPoint(NodeIdx);
+				return Grid.GetCellY(Point.Y) * Grid.NumCellsX + Grid.GetCellX(Point.X);
+			};
+
+			for (int32 NodeIdx = 0; NodeIdx < Nodes.Num(); NodeIdx++)
+			{
+				if (Nodes[NodeIdx].bIsReflex)
+				{
+					Grid.CellStarts[GetCell(NodeIdx) + 1]++;
+				}
+			}
+			for (int32 CellIdx = 0; CellIdx < NumCells; CellIdx++)
+			{
+				Grid.CellStarts[CellIdx + 1] += Grid.CellStarts[CellIdx];
+			}
+
+			TArray<int32> CellFill(Grid.CellStarts.GetData(), NumCells);
+			for (int32 NodeIdx = 0; NodeIdx < Nodes.Num(); NodeIdx++)
+			{
+				if (Nodes[NodeIdx].bIsReflex)
+				{
+					Grid.CellNodes[CellFill[GetCell(NodeIdx)]++] = NodeIdx;
+				}
+			}
+		}
+
+		FORCEINLINE const FVector2D& GetPoint(int32 NodeIdx) const
+		{
+			return Points[Nodes[NodeIdx].Point];
+		}
+
+		FORCEINLINE bool IsReflex(int32 NodeIdx) const
+		{
+			const FNode& Node = Nodes[NodeIdx];
+			return PolygonLoops::Orient(GetPoint(Node.Prev), GetPoint(NodeIdx), GetPoint(Node.Next)) <= 0.0;
+		}
+
+		/** Same criteria as Snip, only testing the reflex vertices of the grid cells the triangle overlaps. */
+		bool IsEar(int32 EarIdx) const
+		{
+			const FNode& EarNode = Nodes[EarIdx];
+			const FVector2D& A = GetPoint(EarNode.Prev);
+			const FVector2D& B = GetPoint(EarIdx);
+			const FVector2D& C = GetPoint(EarNode.Next);
+
+			if (SMALL_NUMBER > PolygonLoops::Orient(A, B, C) &&
+
+				// Don't fail because of degenerate points
+				(A - B).SizeSquared() > SMALL_NUMBER &&
+				(B - C).SizeSquared() > SMALL_NUMBER &&
+				(C - A).SizeSquared() > SMALL_NUMBER)
+			{
+				return false;
+			}
+
+			const FVector2D* Edges[3][2] = { { &A, &B }, { &B, &C }, { &C, &A } };
+
+			const int32 FirstRow = Grid.GetCellY(FMath::Min3(A.Y, B.Y, C.Y));
+			const int32 LastRow = Grid.GetCellY(FMath::Max3(A.Y, B.Y, C.Y));
+			for (int32 Row = FirstRow; Row <= LastRow; Row++)
+			{
+				// Horizontal extent of the triangle within the row, from its edges clipped to the row
+				const double RowMinY = Grid.MinPoint.Y + Row / Grid.InvCellSize.Y;
+				const double RowMaxY = Grid.MinPoint.Y + (Row + 1) / Grid.InvCellSize.Y;
+
+				double MinX = MAX_dbl;
+				double MaxX = -MAX_dbl;
+				for (const auto& Edge : Edges)
+				{
+					const FVector2D& P = *Edge[0];
+					const FVector2D& Q = *Edge[1];
+					if (FMath::Max(P.Y, Q.Y) < RowMinY || FMath::Min(P.Y, Q.Y) > RowMaxY)
+					{
+						continue;
+					}
+
+					double ClippedX0 = P.X;
+					double ClippedX1 = Q.X;
+					if (P.Y != Q.Y)
+					{
+						const double Alpha0 = FMath::Clamp((RowMinY - P.Y) / (Q.Y - P.Y), 0.0, 1.0);
+						const double Alpha1 = FMath::Clamp((RowMaxY - P.Y) / (Q.Y - P.Y), 0.0, 1.0);
+						ClippedX0 = P.X + (Q.X - P.X) * Alpha0;
+						ClippedX1 = P.X + (Q.X - P.X) * Alpha1;
+					}
+					MinX = FMath::Min3(MinX, ClippedX0, ClippedX1);
+					MaxX = FMath::Max3(MaxX, ClippedX0, ClippedX1);
+				}
+
+				if (MinX > MaxX)
+				{
+					continue;
+				}
+
+				const int32 FirstCell = Row * Grid.NumCellsX + Grid.GetCellX(MinX);
+				const int32 LastCell = Row * Grid.NumCellsX + Grid.GetCellX(MaxX);
+				for (int32 NodeSlot = Grid.CellStarts[FirstCell]; NodeSlot < Grid.CellStarts[LastCell + 1]; NodeSlot++)
+				{
+					const FNode& Node = Nodes[Grid.CellNodes[NodeSlot]];
+					if (!Node.bIsReflex || Node.bIsRemoved)
+					{
+						continue;
+					}
+
+					// Hole bridges visit the same vertex twice
+					if (Node.Point == Nodes[EarNode.Prev].Point || Node.Point == EarNode.Point || Node.Point == Nodes[EarNode.Next].Point)
+					{
+						continue;
+					}
+
+					if (FPolygonTools::IsPointInsideTriangle(A, B, C, Points[Node.Point]))
+					{
+						return false;
+					}
+				}
+			}
+
+			return true;
+		}
+
+		static constexpr int32 MaxCellsPerAxis = 1024;
+
+		const TArray<FVector2D>& Points;
+		TArray<FNode> Nodes;
+		FReflexGrid Grid;
+	};
+}
+
+bool FPolygonTools::ClipEarsIndexed(const TArray<FVector2D>& Points, TArray<int32>& VertexIndices, const uint32* SourceIndices, TArray<uint32>& TriangulatedIndices, int32 StartVertex)
+{
+	if (VertexIndices.Num() < 3)
+	{
+		return false;
+	}
+
+	const int32 FirstIndex = TriangulatedIndices.Num();
+
+	IndexedEarClipping::FTriangulator Triangulator(Points, VertexIndices);
+	if (Triangulator.Triangulate(SourceIndices, TriangulatedIndices, StartVertex))
+	{
+		return true;
+	}
+
+	// Stalled, usually on self touching outlines. Start over with plain ear clipping.
+	TriangulatedIndices.SetNum(FirstIndex, false);
+	return ClipEars(Points, VertexIndices, SourceIndices, TriangulatedIndices, StartVertex);
+}
+
+bool FPolygonTools::TriangulatePolygonWithHoles(const TArray<FVector2D>& Polygon, const TArray<TArray<FVector2D>>& Holes, TArray<uint32>& TriangulatedIndices, int32 StartVertex, EVectorTriangulationMethod Method)
+{
+	if (Polygon.Num() < 3)
+	{
+		return false;
+	}
+
+	if (Holes.Num() == 0)
+	{
+		return TriangulatePolygon(Polygon, TriangulatedIndices, StartVertex, Method);
+	}
+
+	int32 NumPoints = Polygon.Num();
+	for (const TArray<FVector2D>& Hole : Holes)
+	{
+		NumPoints += Hole.Num();
+	}
+
+	PolygonLoops::FPolygonLoops Loops;
+	Loops.Reserve(NumPoints);
+	Loops.AddLoop(Polygon, true, 0);
+
+	uint32 FirstSourceIndex = Polygon.Num();
+	for (const TArray<FVector2D>& Hole : Holes)
+	{
+		// Degenerate holes still own their vertices in the caller's layout
+		if (Hole.Num() >= 3)
+		{
+			Loops.AddLoop(Hole, false, FirstSourceIndex);
+		}
+		FirstSourceIndex += Hole.Num();
+	}
+
+	switch (Method)
+	{
+	case EVectorTriangulationMethod::MonotoneSweep:
+		return MonotoneTriangulation::Triangulate(Loops, TriangulatedIndices, StartVertex);
+
+	case EVectorTriangulationMethod::IndexedEarClipping:
+	case EVectorTriangulationMethod::EarClipping:
+	default:
+	{
+		TArray<int32> Contour;
+		if (!HoleBridging::Bridge(Loops, Contour))
+		{
+			return false;
+		}
+
+		if (Method == EVectorTriangulationMethod::IndexedEarClipping)
+		{
+			return ClipEarsIndexed(Loops.Points, Contour, Loops.SourceIndices.GetData(), TriangulatedIndices, StartVertex);
+		}
+		return ClipEars(Loops.Points, Contour, Loops.SourceIndices.GetData(), TriangulatedIndices, StartVertex);
+	}
+	}
+}
+
+bool FPolygonTools::TriangulateSimplePolygon(TArray<uint32>& TriangulatedIndices, int32 NumVertices, int32 StartVertex)
+{
+	if (NumVertices < 3)
+	{
+		return false;
+	}
+
+	for (int32 Idx = 1; Idx < NumVertices - 1; Idx++)
+	{
+		new(TriangulatedIndices) int32(StartVertex);
+		new(TriangulatedIndices) int32(StartVertex + Idx + 0);
+		new(TriangulatedIndices) int32(StartVertex + Idx + 1);
+	}
+	return  true;
+}
+
+namespace PolygonCleanup
+{
+	/** Points closer than this are merged. */
+	static constexpr float DuplicateDistanceSquared = 1.0f;
+
+	static FORCEINLINE bool AreCollinear(const FVector2D& A, const FVector2D& B, const FVector2D& C)
+	{
+		// Determine if the area of the triangle ABC is zero (if so, they're collinear)
+		const float AreaABC = (A.X * (B.Y - C.Y)) + (B.X * (C.Y - A.Y)) + (C.X * (A.Y - B.Y));
+		return FMath::Abs(AreaABC) < KINDA_SMALL_NUMBER;
+	}
+
+	static FORCEINLINE bool AreDuplicated(const FVector2D& A, const FVector2D& B)
+	{
+		return (B - A).SizeSquared() < DuplicateDistanceSquared;
+	}
+
+	/** Keeps the points in [FirstKept, NumKept) at the front of the list. */
+	static void Compact(TArray<FVector2D>& PointList, int32 FirstKept, int32 NumKept)
+	{
+		if (FirstKept > 0)
+		{
+			FMemory::Memmove(PointList.GetData(), PointList.GetData() + FirstKept, (NumKept - FirstKept) * sizeof(FVector2D));
+		}
+		PointList.SetNum(NumKept - FirstKept, false);
+	}
+}
+
+void FPolygonTools::RemoveCollinearPoints(TArray<FVector2D>& PointList)
+{
+	const int32 NumPoints = PointList.Num();
+	if (NumPoints < 3)
+	{
+		return;
+	}
+
+	FVector2D* Points = PointList.GetData();
+
+	// Kept points are written behind the read cursor, the first point is only tested once the loop is closed
+	int32 NumKept = 1;
+	for (int32 ReadIdx = 1; ReadIdx < NumPoints; ReadIdx++)
+	{
+		const FVector2D& Next = Points[(ReadIdx + 1 < NumPoints) ? ReadIdx + 1 : 0];
+		if (!PolygonCleanup::AreCollinear(Points[NumKept - 1], Points[ReadIdx], Next))
+		{
+			Points[NumKept++] = Points[ReadIdx];
+		}
+	}
+
+	// Wrap around to get the final triples of vertices (N-2, N-1, 0) and (N-1, 0, 1)
+	int32 FirstKept = 0;
+	while (NumKept - FirstKept >= 3)
+	{
+		if (PolygonCleanup::AreCollinear(Points[NumKept - 2], Points[NumKept - 1], Points[FirstKept]))
+		{
+			NumKept--;
+		}
+		else if (PolygonCleanup::AreCollinear(Points[NumKept - 1], Points[FirstKept], Points[FirstKept + 1]))
+		{
+			FirstKept++;
+		}
+		else
+		{
+			break;
+		}
+	}
+
+	PolygonCleanup::Compact(PointList, FirstKept, NumKept);
+}
+
+void FPolygonTools::RemoveDuplicatedPoints(TArray<FVector2D>& PointList)
+{
+	const int32 NumPoints = PointList.Num();
+	if (NumPoints < 3)
+	{
+		return;
+	}
+
+	FVector2D* Points = PointList.GetData();
+
+	int32 NumKept = 1;
+	for (int32 ReadIdx = 1; ReadIdx < NumPoints; ReadIdx++)
+	{
+		if (!PolygonCleanup::AreDuplicated(Points[NumKept - 1], Points[ReadIdx]))
+		{
+			Points[NumKept++] = Points[ReadIdx];
+		}
+	}
+
+	// The first point is dropped if it duplicates the last one
+	int32 FirstKept = 0;
+	while (NumKept - FirstKept > 1 && PolygonCleanup::AreDuplicated(Points[NumKept - 1], Points[FirstKept]))
+	{
+		FirstKept++;
+	}
+
+	PolygonCleanup::Compact(PointList, FirstKept, NumKept);
+}
+
+void FPolygonTools::CleanPolygon(TArray<FVector2D>& PointList)
+{
+	const int32 NumPoints = PointList.Num();
+	if (NumPoints < 3)
+	{
+		return;
+	}
+
+	FVector2D* Points = PointList.GetData();
+
+	// Kept points form a stack behind the read cursor. Every point is pushed and popped at most once.
+	int32 NumKept = 0;
+	for (int32 ReadIdx = 0; ReadIdx < NumPoints; ReadIdx++)
+	{
+		const FVector2D Point = Points[ReadIdx];
+
+		if (NumKept > 0 && PolygonCleanup::AreDuplicated(Points[NumKept - 1], Point))
+		{
+			continue;
+		}
+
+		// Zero area corners are either straight runs or spikes folding back on themselves
+		while (NumKept >= 2 && PolygonCleanup::AreCollinear(Points[NumKept - 2], Points[NumKept - 1], Point))
+		{
+			NumKept--;
+		}
+
+		if (NumKept > 0 && PolygonCleanup::AreDuplicated(Points[NumKept - 1], Point))
+		{
+			continue;
+		}
+
+		Points[NumKept++] = Point;
+	}
+
+	// Close the loop, the last and first points get tested against both their neighbours
+	int32 FirstKept = 0;
+	while (NumKept - FirstKept >= 3)
+	{
+		if (PolygonCleanup::AreDuplicated(Points[NumKept - 1], Points[FirstKept])
+			|| PolygonCleanup::AreCollinear(Points[NumKept - 2], Points[NumKept - 1], Points[FirstKept]))
+		{
+			NumKept--;
+		}
+		else if (PolygonCleanup::AreCollinear(Points[NumKept - 1], Points[FirstKept], Points[FirstKept + 1]))
+		{
+			FirstKept++;
+		}
+		else
+		{
+			break;
+		}
+	}
+
+	PolygonCleanup::Compact(PointList, FirstKept, NumKept);
+}
+
+namespace SelfIntersections
+{
+	using PolygonLoops::Orient;
+
+	/** Finds where segments AB and CD cross, touching and collinear segments do not count. */
+	static bool SegmentsCross(const FVector2D& A, const FVector2D& B, const FVector2D& C, const FVector2D& D, FVector2D& OutPoint)
+	{
+		const double OrientC = Orient(A, B, C);
+		const double OrientD = Orient(A, B, D);
+		const double OrientA = Orient(C, D, A);
+		const double OrientB = Orient(C, D, B);
+
+		if (((OrientC > 0.0 && OrientD < 0.0) || (OrientC < 0.0 && OrientD > 0.0)) && ((OrientA > 0.0 && OrientB < 0.0) || (OrientA < 0.0 && OrientB > 0.0)))
+		{
+			OutPoint = A + (B - A) * (OrientA / (OrientA - OrientB));
+			return true;
+		}
+		return false;
+	}
+
+	/** Whether P lies on segment AB, ends included. Points closer to the line than the tolerance the sweep orders edges with count as on it. */
+	static bool IsOnSegment(const FVector2D& A, const FVector2D& B, const FVector2D& P)
+	{
+		const FVector2D AB = B - A;
+		const double LengthSquared = AB.SizeSquared();
+		const double Along = (P - A) | AB;
+		return Along >= 0.0 && Along <= LengthSquared && FMath::Square(Orient(A, B, P)) <= FMath::Square(KINDA_SMALL_NUMBER) * LengthSquared;
+	}
+
+	static FORCEINLINE bool IsSamePoint(const FVector2D& A, const FVector2D& B)
+	{
+		return FVector2D::DistSquared(A, B) <= FMath::Square(KINDA_SMALL_NUMBER);
+	}
+
+	/** Sweep order : lower X first, lower Y first on ties. */
+	static FORCEINLINE bool IsBefore(const FVector2D& A, const FVector2D& B)
+	{
+		return (A.X < B.X) || (A.X == B.X && A.Y < B.Y);
+	}
+
+	/** Events sharing a point are processed in this order. */
+	enum class EEventType : uint8
+	{
+		EdgeEnd,
+		Crossing,
+		EdgeStart
+	};
+
+	struct FSweepEvent
+	{
+		FVector2D Point;
+		int32 EdgeA;
+		int32 EdgeB;
+		EEventType Type;
+
+		bool operator<(const FSweepEvent& Other) const
+		{
+			if (Point != Other.Point)
+			{
+				return IsBefore(Point, Other.Point);
+			}
+			return Type < Other.Type;
+		}
+	};
+
+	/** Sweep status : edges crossing the sweep line, kept sorted from bottom to top in an array. */
+	struct FSweepStatus
+	{
+		/** Edge end points in sweep order. */
+		TArray<FVector2D> EdgeStarts;
+		TArray<FVector2D> EdgeEnds;
+		TArray<double> EdgeSlopes;
+
+		TArray<int32> Edges;
+
+		FSweepStatus(const TArray<FVector2D>& Points, const TArray<int32>& Next)
+		{
+			const int32 NumEdges = Points.Num();
+			EdgeStarts.SetNumUninitialized(NumEdges);
+			EdgeEnds.SetNumUninitialized(NumEdges);
+			EdgeSlopes.SetNumUninitialized(NumEdges);
+			for (int32 EdgeIndex = 0; EdgeIndex < NumEdges; EdgeIndex++)
+			{
+				const FVector2D& A = Points[EdgeIndex];
+				const FVector2D& B = Points[Next[EdgeIndex]];
+				const bool bIsForward = IsBefore(A, B);
+				EdgeStarts[EdgeIndex] = bIsForward ? A : B;
+				EdgeEnds[EdgeIndex] = bIsForward ? B : A;
+
+				const FVector2D Delta = EdgeEnds[EdgeIndex] - EdgeStarts[EdgeIndex];
+				EdgeSlopes[EdgeIndex] = (FMath::Abs(Delta.X) <= SMALL_NUMBER) ? MAX_dbl : Delta.Y / Delta.X;
+			}
+		}
+
+		/** Y coordinate of the edge at the abscissa of Point. */
+		double EdgeY(int32 EdgeIndex, const FVector2D& Point) const
+		{
+			const FVector2D& A = EdgeStarts[EdgeIndex];
+			const FVector2D& B = EdgeEnds[EdgeIndex];
+			if (EdgeSlopes[EdgeIndex] == MAX_dbl)
+			{
+				return FMath::Clamp<double>(Point.Y, A.Y, B.Y);
+			}
+			return A.Y + (Point.X - A.X) * EdgeSlopes[EdgeIndex];
+		}
+
+		/** Whether EdgeIndex lies below OtherEdgeIndex just after Point along the sweep. */
+		bool IsBelow(int32 EdgeIndex, int32 OtherEdgeIndex, const FVector2D& Point) const
+		{
+			const double Y = EdgeY(EdgeIndex, Point);
+			const double OtherY = EdgeY(OtherEdgeIndex, Point);
+			if (FMath::Abs(Y - OtherY) > KINDA_SMALL_NUMBER)
+			{
+				return Y < OtherY;
+			}
+			return EdgeSlopes[EdgeIndex] < EdgeSlopes[OtherEdgeIndex];
+		}
+
+		/** Index of the first edge not below EdgeIndex. */
+		int32 LowerBound(int32 EdgeIndex, const FVector2D& Point) const
+		{
+			int32 Low = 0;
+			int32 High = Edges.Num();
+			while (Low < High)
+			{
+				const int32 Mid = (Low + High) / 2;
+				if (IsBelow(Edges[Mid], EdgeIndex, Point))
+				{
+					Low = Mid + 1;
+				}
+				else
+				{
+					High = Mid;
+				}
+			}
+			return Low;
+		}
+
+		int32 Insert(int32 EdgeIndex, const FVector2D& Point)
+		{
+			return Edges.Insert(EdgeIndex, LowerBound(EdgeIndex, Point));
+		}
+
+		/** Position of the edge, the edges crossing at Point are still in their order before it. Edges meeting at their ends or overlapping compare equal, those fall back to a linear search. */
+		int32 Find(int32 EdgeIndex, const FVector2D& Point) const
+		{
+			const int32 Position = LowerBound(EdgeIndex, Point);
+			for (int32 Candidate = Position - 1; Candidate <= Position + 1; Candidate++)
+			{
+				if (Edges.IsValidIndex(Candidate) && Edges[Candidate] == EdgeIndex)
+				{
+					return Candidate;
+				}
+			}
+			return Edges.Find(EdgeIndex);
+		}
+
+		int32 EdgeAt(int32 Position) const
+		{
+			return Edges.IsValidIndex(Position) ? Edges[Position] : INDEX_NONE;
+		}
+	};
+
+	/**
+	 * Bentley-Ottmann sweep over closed loops packed in a single point array, edge I going from point I to point Next[I].
+	 * Reports the crossings between edges that do not share a point, and the points lying on an edge or on another point of the outline
+	 * that are not next to them. Those are reported on the edges starting at the point, as a crossing at the start of the edge.
+	 */
+	static void SweepCrossings(const TArray<FVector2D>& Points, const TArray<int32>& Next, TArray<FPolygonEdgeCrossing>& OutCrossings)
+	{
+		const int32 NumEdges = Points.Num();
+		FSweepStatus Status(Points, Next);
+
+		TArray<FSweepEvent> Events;
+		Events.Reserve(2 * NumEdges);
+		for (int32 EdgeIndex = 0; EdgeIndex < NumEdges; EdgeIndex++)
+		{
+			Events.Add({ Status.EdgeStarts[EdgeIndex], EdgeIndex, INDEX_NONE, EEventType::EdgeStart });
+			Events.Add({ Status.EdgeEnds[EdgeIndex], EdgeIndex, INDEX_NONE, EEventType::EdgeEnd });
+		}
+		Events.Heapify();
+
+		// A pair of straight edges crosses at most once
+		TSet<uint64> CrossingPairs;
+
+		// A point touching the outline is found from every edge pair meeting there, it is reported once per point and edge it lies on
+		TSet<uint64> TouchingKeys;
+
+		auto AddTouching = [&](int32 Point, int32 Edge)
+		{
+			// A point on the end of an edge is the start of the next one
+			int32 OtherPoint = INDEX_NONE;
+			if (IsSamePoint(Points[Point], Points[Edge]))
+			{
+				OtherPoint = Edge;
+			}
+			else if (IsSamePoint(Points[Point], Points[Next[Edge]]))
+			{
+				OtherPoint = Next[Edge];
+			}
+
+			uint64 TouchingKey = ((uint64)Point << 32) | (uint64)Edge;
+			if (OtherPoint != INDEX_NONE)
+			{
+				// Consecutive points only match when an edge has no length
+				if (OtherPoint == Point || Next[OtherPoint] == Point || Next[Point] == OtherPoint)
+				{
+					return;
+				}
+				TouchingKey = (1ull << 63) | ((uint64)FMath::Min(Point, OtherPoint) << 32) | (uint64)FMath::Max(Point, OtherPoint);
+			}
+
+			bool bAlreadyFound = false;
+			TouchingKeys.Add(TouchingKey, &bAlreadyFound);
+			if (!bAlreadyFound)
+			{
+				const int32 TouchedEdge = (OtherPoint != INDEX_NONE) ? OtherPoint : Edge;
+				OutCrossings.Add({ FMath::Min(Point, TouchedEdge), FMath::Max(Point, TouchedEdge), Points[Point] });
+			}
+		};
+
+		auto TestEdges = [&](int32 EdgeA, int32 EdgeB)
+		{
+			if (EdgeA == INDEX_NONE || EdgeB == INDEX_NONE)
+			{
+				return;
+			}
+
+			// Consecutive edges share a point
+			if (Next[EdgeA] == EdgeB || Next[EdgeB] == EdgeA)
+			{
+				return;
+			}
+
+			// An end point lying on the other edge : the edges touch, or overlap between two such points. Touching edges keep their order in the status.
+			const FVector2D& A = Points[EdgeA];
+			const FVector2D& B = Points[Next[EdgeA]];
+			const FVector2D& C = Points[EdgeB];
+			const FVector2D& D = Points[Next[EdgeB]];
+			const bool bTouchesA = IsOnSegment(C, D, A);
+			const bool bTouchesB = IsOnSegment(C, D, B);
+			const bool bTouchesC = IsOnSegment(A, B, C);
+			const bool bTouchesD = IsOnSegment(A, B, D);
+			if (bTouchesA || bTouchesB || bTouchesC || bTouchesD)
+			{
+				if (bTouchesA)
+				{
+					AddTouching(EdgeA, EdgeB);
+				}
+				if (bTouchesB)
+				{
+					AddTouching(Next[EdgeA], EdgeB);
+				}
+				if (bTouchesC)
+				{
+					AddTouching(EdgeB, EdgeA);
+				}
+				if (bTouchesD)
+				{
+					AddTouching(Next[EdgeB], EdgeA);
+				}
+				return;
+			}
+
+			FVector2D Crossing;
+			if (SegmentsCross(Points[EdgeA], Points[Next[EdgeA]], Points[EdgeB], Points[Next[EdgeB]], Crossing))
+			{
+				const uint64 PairKey = ((uint64)FMath::Min(EdgeA, EdgeB) << 32) | (uint64)FMath::Max(EdgeA, EdgeB);
+				bool bAlreadyFound = false;
+				CrossingPairs.Add(PairKey, &bAlreadyFound);
+				if (!bAlreadyFound)
+				{
+					Events.HeapPush({ Crossing, EdgeA, EdgeB, EEventType::Crossing });
+				}
+			}
+		};
+
+		while (Events.Num() > 0)
+		{
+			FSweepEvent Event;
+			Events.HeapPop(Event, false);
+
+			switch (Event.Type)
+			{
+			case EEventType::EdgeStart:
+			{
+				const int32 Position = Status.Insert(Event.EdgeA, Event.Point);
+				TestEdges(Status.EdgeAt(Position - 1), Event.EdgeA);
+				TestEdges(Event.EdgeA, Status.EdgeAt(Position + 1));
+				break;
+			}
+
+			case EEventType::EdgeEnd:
+			{
+				const int32 Position = Status.Find(Event.EdgeA, Event.Point);
+				if (Position != INDEX_NONE)
+				{
+					Status.Edges.RemoveAt(Position, 1, false);
+					TestEdges(Status.EdgeAt(Position - 1), Status.EdgeAt(Position));
+				}
+				break;
+			}
+
+			case EEventType::Crossing:
+			{
+				OutCrossings.Add({ FMath::Min(Event.EdgeA, Event.EdgeB), FMath::Max(Event.EdgeA, Event.EdgeB), Event.Point });
+
+				// The edges swap places past the crossing, and each meets a new neighbour
+				const int32 PositionA = Status.Find(Event.EdgeA, Event.Point);
+				const int32 PositionB = Status.Find(Event.EdgeB, Event.Point);
+				if (PositionA != INDEX_NONE && PositionB != INDEX_NONE)
+				{
+					Status.Edges.Swap(PositionA, PositionB);
+
+					const int32 Lower = FMath::Min(PositionA, PositionB);
+					const int32 Upper = FMath::Max(PositionA, PositionB);
+					TestEdges(Status.EdgeAt(Lower - 1), Status.EdgeAt(Lower));
+					TestEdges(Status.EdgeAt(Upper), Status.EdgeAt(Upper + 1));
+				}
+				break;
+			}
+			}
+		}
+	}
+
+	/** Closed loop left once the outline is split at its crossings, and the loops nested in it. */
+	struct FSplitLoop
+	{
+		TArray<FVector2D> Points;
+		FBox2D Bounds;
+		double Area;
+		int32 Parent;
+		int32 Winding;
+	};
+}
+
+bool FPolygonTools::FindSelfIntersections(const TArray<FVector2D>& Polygon, TArray<FPolygonEdgeCrossing>& OutCrossings)
+{
+	OutCrossings.Reset();
+
+	const int32 NumPoints = Polygon.Num();
+	if (NumPoints < 4)
+	{
+		return false;
+	}
+
+	TArray<int32> Next;
+	Next.SetNumUninitialized(NumPoints);
+	for (int32 PointIdx = 0; PointIdx < NumPoints; PointIdx++)
+	{
+		Next[PointIdx] = (PointIdx + 1) % NumPoints;
+	}
+
+	SelfIntersections::SweepCrossings(Polygon, Next, OutCrossings);
+	return OutCrossings.Num() > 0;
+}
+
+bool FPolygonTools::IsPolygonInsidePolygon(const TArray<FVector2D>& Inner, const TArray<FVector2D>& Outer)
+{
+	const int32 NumInner = Inner.Num();
+	const int32 NumOuter = Outer.Num();
+	if (NumInner < 3 || NumOuter < 3 || !FBox2D(Outer).IsInside(FBox2D(Inner)))
+	{
+		return false;
+	}
+
+	for (const FVector2D& Point : Inner)
+	{
+		if (!IsPointInsidePolygon(Outer, Point))
+		{
+			return false;
+		}
+	}
+
+	// Both loops in one sweep, only crossings between them matter
+	TArray<FVector2D> Points;
+	TArray<int32> Next;
+	Points.Reserve(NumInner + NumOuter);
+	Next.Reserve(NumInner + NumOuter);
+	Points.Append(Inner);
+	Points.Append(Outer);
+	for (int32 PointIdx = 0; PointIdx < NumInner; PointIdx++)
+	{
+		Next.Add((PointIdx + 1) % NumInner);
+	}
+	for (int32 PointIdx = 0; PointIdx < NumOuter; PointIdx++)
+	{
+		Next.Add(NumInner + (PointIdx + 1) % NumOuter);
+	}
+
+	TArray<FPolygonEdgeCrossing> Crossings;
+	SelfIntersections::SweepCrossings(Points, Next, Crossings);
+	for (const FPolygonEdgeCrossing& Crossing : Crossings)
+	{
+		if ((Crossing.EdgeA < NumInner) != (Crossing.EdgeB < NumInner))
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+void FPolygonTools::SplitSelfIntersections(const TArray<FVector2D>& Polygon, const TArray<FPolygonEdgeCrossing>& Crossings, EVectorFillRule FillRule, TArray<FVectorPolygon>& OutPolygons)
+{
+	using namespace SelfIntersections;
+
+	OutPolygons.Reset();
+
+	const int32 NumPoints = Polygon.Num();
+	const int32 NumCrossings = Crossings.Num();
+	if (NumPoints < 3)
+	{
+		return;
+	}
+
+	// Crossings along each edge, in the direction of the outline
+	struct FEdgeCrossing
+	{
+		int32 Edge;
+		double Distance;
+		int32 Crossing;
+	};
+
+	TArray<FEdgeCrossing> EdgeCrossings;
+	EdgeCrossings.Reserve(2 * NumCrossings);
+	for (int32 CrossingIdx = 0; CrossingIdx < NumCrossings; CrossingIdx++)
+	{
+		const FPolygonEdgeCrossing& Crossing = Crossings[CrossingIdx];
+		EdgeCrossings.Add({ Crossing.EdgeA, FVector2D::DistSquared(Polygon[Crossing.EdgeA], Crossing.Point), CrossingIdx });
+		EdgeCrossings.Add({ Crossing.EdgeB, FVector2D::DistSquared(Polygon[Crossing.EdgeB], Crossing.Point), CrossingIdx });
+	}
+	EdgeCrossings.Sort([](const FEdgeCrossing& A, const FEdgeCrossing& B) { return A.Edge < B.Edge || (A.Edge == B.Edge && A.Distance < B.Distance); });
+
+	// Walk the outline through every crossing, each crossing is passed twice
+	const int32 NumSlots = NumPoints + 2 * NumCrossings;
+	TArray<FVector2D> SlotPoints;
+	TArray<int32> SlotNext;
+	TArray<FIntPoint> CrossingSlots;
+	SlotPoints.Reserve(NumSlots);
+	SlotNext.SetNumUninitialized(NumSlots);
+	CrossingSlots.Init(FIntPoint(INDEX_NONE, INDEX_NONE), NumCrossings);
+
+	int32 EdgeCrossingIdx = 0;
+	for (int32 PointIdx = 0; PointIdx < NumPoints; PointIdx++)
+	{
+		SlotPoints.Add(Polygon[PointIdx]);
+		for (; EdgeCrossingIdx < EdgeCrossings.Num() && EdgeCrossings[EdgeCrossingIdx].Edge == PointIdx; EdgeCrossingIdx++)
+		{
+			const int32 CrossingIdx = EdgeCrossings[EdgeCrossingIdx].Crossing;
+			FIntPoint& Slots = CrossingSlots[CrossingIdx];
+			(Slots.X == INDEX_NONE ? Slots.X : Slots.Y) = SlotPoints.Add(Crossings[CrossingIdx].Point);
+		}
+	}
+
+	for (int32 SlotIdx = 0; SlotIdx < NumSlots; SlotIdx++)
+	{
+		SlotNext[SlotIdx] = (SlotIdx + 1) % NumSlots;
+	}
+
+	// Both passes through a crossing leave along the other edge : the loops only touch there, and keep the direction of the outline
+	for (const FIntPoint& Slots : CrossingSlots)
+	{
+		Swap(SlotNext[Slots.X], SlotNext[Slots.Y]);
+	}
+
+	TArray<FSplitLoop> Loops;
+	TBitArray<> VisitedSlots(false, NumSlots);
+	for (int32 FirstSlot = 0; FirstSlot < NumSlots; FirstSlot++)
+	{
+		if (VisitedSlots[FirstSlot])
+		{
+			continue;
+		}
+
+		TArray<FVector2D> LoopPoints;
+		for (int32 Slot = FirstSlot; !VisitedSlots[Slot]; Slot = SlotNext[Slot])
+		{
+			VisitedSlots[Slot] = true;
+			LoopPoints.Add(SlotPoints[Slot]);
+		}
+
+		CleanPolygon(LoopPoints);
+
+		const float LoopArea = Area(LoopPoints);
+		if (LoopPoints.Num() >= 3 && !FMath::IsNearlyZero(LoopArea))
+		{
+			FSplitLoop& Loop = Loops.AddDefaulted_GetRef();
+			Loop.Bounds = FBox2D(LoopPoints);
+			Loop.Points = MoveTemp(LoopPoints);
+			Loop.Area = LoopArea;
+			Loop.Parent = INDEX_NONE;
+			Loop.Winding = 0;
+		}
+	}
+
+	// Loops never cross, each one lies in the smallest loop containing any point of its boundary. Parents come first once sorted by size.
+	Loops.Sort([](const FSplitLoop& A, const FSplitLoop& B) { return FMath::Abs(A.Area) > FMath::Abs(B.Area); });
+
+	const int32 NumLoops = Loops.Num();
+	for (int32 LoopIdx = 0; LoopIdx < NumLoops; LoopIdx++)
+	{
+		FSplitLoop& Loop = Loops[LoopIdx];
+
+		// Edge midpoints lie on no other loop, unlike the crossings
+		const FVector2D Probe = (Loop.Points[0] + Loop.Points[1]) * 0.5f;
+		for (int32 ParentIdx = LoopIdx - 1; ParentIdx >= 0; ParentIdx--)
+		{
+			if (Loops[ParentIdx].Bounds.IsInside(Probe) && IsPointInsidePolygon(Loops[ParentIdx].Points, Probe))
+			{
+				Loop.Parent = ParentIdx;
+				break;
+			}
+		}
+
+		const int32 ParentWinding = (Loop.Parent != INDEX_NONE) ? Loops[Loop.Parent].Winding : 0;
+		Loop.Winding = ParentWinding + ((Loop.Area > 0.0) ? 1 : -1);
+	}
+
+	// Each filled loop is output with its children cut out, filled children are output on their own
+	TArray<int32> LoopPolygons;
+	LoopPolygons.Init(INDEX_NONE, NumLoops);
+	for (int32 LoopIdx = 0; LoopIdx < NumLoops; LoopIdx++)
+	{
+		FSplitLoop& Loop = Loops[LoopIdx];
+		const bool bIsFilled = (FillRule == EVectorFillRule::EvenOdd) ? (Loop.Winding % 2 != 0) : (Loop.Winding != 0);
+
+		if (Loop.Parent != INDEX_NONE && LoopPolygons[Loop.Parent] != INDEX_NONE)
+		{
+			TArray<FVector2D>& Hole = OutPolygons[LoopPolygons[Loop.Parent]].Holes.Add_GetRef(Loop.Points);
+			if (Loop.Area > 0.0)
+			{
+				Algo::Reverse(Hole);
+			}
+		}
+
+		if (bIsFilled)
+		{
+			LoopPolygons[LoopIdx] = OutPolygons.Num();
+			FVectorPolygon& OutPolygon = OutPolygons.AddDefaulted_GetRef();
+			OutPolygon.Contour = MoveTemp(Loop.Points);
+			if (Loop.Area < 0.0)
+			{
+				Algo::Reverse(OutPolygon.Contour);
+			}
+		}
+	}
+}
+
+namespace PolygonClipping
+{
+	/** Closed loop of a clipping result, and what its nesting is decided from. */
+	struct FClippedLoop
+	{
+		TArray<FVector2D> Points;
+		FBox2D Bounds;
+		float Area;
+	};
+
+	/** Even-odd test against every contour and hole of an operand. */
+	static bool IsInsideOperand(const TArray<FVectorPolygon>& Operand, const TArray<FBox2D>& OperandBounds, const FVector2D& Point)
+	{
+		bool bIsInside = false;
+		for (int32 PolygonIdx = 0; PolygonIdx < Operand.Num(); PolygonIdx++)
+		{
+			const FVectorPolygon& Polygon = Operand[PolygonIdx];
+			if (!OperandBounds[PolygonIdx].IsInside(Point) || !FPolygonTools::IsPointInsidePolygon(Polygon.Contour, Point))
+			{
+				continue;
+			}
+
+			bIsInside = !bIsInside;
+			for (const TArray<FVector2D>& Hole : Polygon.Holes)
+			{
+				if (FPolygonTools::IsPointInsidePolygon(Hole, Point))
+				{
+					bIsInside = !bIsInside;
+				}
+			}
+		}
+		return bIsInside;
+	}
+
+	static void GetOperandBounds(const TArray<FVectorPolygon>& Operand, TArray<FBox2D>& OutBounds)
+	{
+		OutBounds.Reset(Operand.Num());
+		for (const FVectorPolygon& Polygon : Operand)
+		{
+			OutBounds.Add(FBox2D(Polygon.Contour));
+		}
+	}
+}
+
+void FPolygonTools::ClipPolygons(const TArray<FVectorPolygon>& Subject, const TArray<FVectorPolygon>& Clip, EVectorBooleanOperation Operation, TArray<FVectorPolygon>& OutPolygons)
+{
+	using namespace PolygonClipping;
+
+	OutPolygons.Reset();
+
+	if (Subject.Num() == 0 || Clip.Num() == 0)
+	{
+		if (Operation == EVectorBooleanOperation::Union)
+		{
+			OutPolygons = (Subject.Num() > 0) ? Subject : Clip;
+		}
+		else if (Operation == EVectorBooleanOperation::Difference)
+		{
+			OutPolygons = Subject;
+		}
+		return;
+	}
+
+	// Pack the loops of both operands, contours counter clockwise and holes clockwise
+	TArray<FVector2D> Points;
+	TArray<int32> Next;
+	TArray<uint8> PointOperands;
+	TArray<int32> LoopStarts;
+
+	auto AddLoop = [&](const TArray<FVector2D>& Loop, bool bCounterClockwise, uint8 Operand)
+	{
+		const int32 NumLoopPoints = Loop.Num();
+		if (NumLoopPoints < 3)
+		{
+			return;
+		}
+
+		const int32 First = Points.Num();
+		const bool bIsReversed = (Area(Loop) > 0.0f) != bCounterClockwise;
+
+		LoopStarts.Add(First);
+		for (int32 LoopIdx = 0; LoopIdx < NumLoopPoints; LoopIdx++)
+		{
+			Points.Add(Loop[bIsReversed ? (NumLoopPoints - 1 - LoopIdx) : LoopIdx]);
+			Next.Add(First + (LoopIdx + 1) % NumLoopPoints);
+			PointOperands.Add(Operand);
+		}
+	};
+
+	for (const FVectorPolygon& Polygon : Subject)
+	{
+		AddLoop(Polygon.Contour, true, 0);
+		for (const TArray<FVector2D>& Hole : Polygon.Holes)
+		{
+			AddLoop(Hole, false, 0);
+		}
+	}
+
+	for (const FVectorPolygon& Polygon : Clip)
+	{
+		AddLoop(Polygon.Contour, true, 1);
+		for (const TArray<FVector2D>& Hole : Polygon.Holes)
+		{
+			AddLoop(Hole, false, 1);
+		}
+	}
+
+	const int32 NumLoops = LoopStarts.Num();
+	LoopStarts.Add(Points.Num());
+
+	// Edges are only split where the operands cross or touch each other, each operand is expected to be free of self crossings
+	TArray<FPolygonEdgeCrossing> Crossings;
+	SelfIntersections::SweepCrossings(Points, Next, Crossings);
+	Crossings.RemoveAll([&PointOperands](const FPolygonEdgeCrossing& Crossing) { return PointOperands[Crossing.EdgeA] == PointOperands[Crossing.EdgeB]; });
+
+	const int32 NumCrossings = Crossings.Num();
+
+	struct FEdgeCrossing
+	{
+		int32 Edge;
+		double Distance;
+		int32 Crossing;
+	};
+
+	TArray<FEdgeCrossing> EdgeCrossings;
+	EdgeCrossings.Reserve(2 * NumCrossings);
+	for (int32 CrossingIdx = 0; CrossingIdx < NumCrossings; CrossingIdx++)
+	{
+		const FPolygonEdgeCrossing& Crossing = Crossings[CrossingIdx];
+		EdgeCrossings.Add({ Crossing.EdgeA, FVector2D::DistSquared(Points[Crossing.EdgeA], Crossing.Point), CrossingIdx });
+		EdgeCrossings.Add({ Crossing.EdgeB, FVector2D::DistSquared(Points[Crossing.EdgeB], Crossing.Point), CrossingIdx });
+	}
+	EdgeCrossings.Sort([](const FEdgeCrossing& A, const FEdgeCrossing& B) { return A.Edge < B.Edge || (A.Edge == B.Edge && A.Distance < B.Distance); });
+
+	// Walk every loop through its crossings. Slots at the same point share a node, points touching the other operand are copied from it and match exactly.
+	const int32 NumSlots = Points.Num() + 2 * NumCrossings;
+	TArray<int32> SlotNext;
+	TArray<int32> SlotNodes;
+	TArray<FVector2D> NodePoints;
+	TArray<uint8> NodeOperands;
+	TMap<FVector2D, int32> PointNodes;
+	TArray<int32> LoopSlotStarts;
+	SlotNext.Reserve(NumSlots);
+	SlotNodes.Reserve(NumSlots);
+	NodePoints.Reserve(NumSlots);
+	NodeOperands.Reserve(NumSlots);
+	PointNodes.Reserve(NumSlots);
+	LoopSlotStarts.Reserve(NumLoops + 1);
+
+	auto AddSlot = [&](const FVector2D& Point, uint8 Operand)
+	{
+		int32 Node = INDEX_NONE;
+		if (const int32* FoundNode = PointNodes.Find(Point))
+		{
+			Node = *FoundNode;
+		}
+		else
+		{
+			Node = NodePoints.Add(Point);
+			NodeOperands.Add(0);
+			PointNodes.Add(Point, Node);
+		}
+		NodeOperands[Node] |= 1 << Operand;
+		SlotNodes.Add(Node);
+	};
+
+	int32 EdgeCrossingIdx = 0;
+	for (int32 LoopIdx = 0; LoopIdx < NumLoops; LoopIdx++)
+	{
+		const int32 FirstSlot = SlotNodes.Num();
+		LoopSlotStarts.Add(FirstSlot);
+
+		for (int32 PointIdx = LoopStarts[LoopIdx]; PointIdx < LoopStarts[LoopIdx + 1]; PointIdx++)
+		{
+			AddSlot(Points[PointIdx], PointOperands[PointIdx]);
+			for (; EdgeCrossingIdx < EdgeCrossings.Num() && EdgeCrossings[EdgeCrossingIdx].Edge == PointIdx; EdgeCrossingIdx++)
+			{
+				AddSlot(Crossings[EdgeCrossings[EdgeCrossingIdx].Crossing].Point, PointOperands[PointIdx]);
+			}
+		}
+
+		const int32 EndSlot = SlotNodes.Num();
+		for (int32 Slot = FirstSlot; Slot < EndSlot; Slot++)
+		{
+			SlotNext.Add((Slot + 1 < EndSlot) ? Slot + 1 : FirstSlot);
+		}
+	}
+	LoopSlotStarts.Add(SlotNodes.Num());
+
+	// Nodes both operands pass through are where a piece can change sides, and the only ends of the pieces both operands run along
+	static constexpr uint8 BothOperands = 3;
+	auto GetPieceKey = [](int32 NodeA, int32 NodeB) { return ((uint64)FMath::Min(NodeA, NodeB) << 32) | (uint64)FMath::Max(NodeA, NodeB); };
+
+	TMap<uint64, int32> OperandPieces[2];
+	for (int32 LoopIdx = 0; LoopIdx < NumLoops; LoopIdx++)
+	{
+		TMap<uint64, int32>& LoopPieces = OperandPieces[PointOperands[LoopStarts[LoopIdx]]];
+		for (int32 Slot = LoopSlotStarts[LoopIdx]; Slot < LoopSlotStarts[LoopIdx + 1]; Slot++)
+		{
+			const int32 From = SlotNodes[Slot];
+			const int32 To = SlotNodes[SlotNext[Slot]];
+			if (From != To && NodeOperands[From] == BothOperands && NodeOperands[To] == BothOperands)
+			{
+				LoopPieces.Add(GetPieceKey(From, To), From);
+			}
+		}
+	}
+
+	// Keep the pieces of edges the operation leaves on the boundary. A piece only meets the other operand at its ends, so each run of pieces
+	// between two nodes both operands pass through gets its own point in polygon test, in the middle of its first piece.
+	TArray<FBox2D> SubjectBounds;
+	TArray<FBox2D> ClipBounds;
+	GetOperandBounds(Subject, SubjectBounds);
+	GetOperandBounds(Clip, ClipBounds);
+
+	TArray<int32> EdgeFrom;
+	TArray<int32> EdgeTo;
+	EdgeFrom.Reserve(NumSlots);
+	EdgeTo.Reserve(NumSlots);
+
+	for (int32 LoopIdx = 0; LoopIdx < NumLoops; LoopIdx++)
+	{
+		const bool bIsSubject = PointOperands[LoopStarts[LoopIdx]] == 0;
+		const TMap<uint64, int32>& OtherPieces = OperandPieces[bIsSubject ? 1 : 0];
+
+		bool bHasSide = false;
+		bool bIsInside = false;
+		for (int32 Slot = LoopSlotStarts[LoopIdx]; Slot < LoopSlotStarts[LoopIdx + 1]; Slot++)
+		{
+			const int32 From = SlotNodes[Slot];
+			const int32 To = SlotNodes[SlotNext[Slot]];
+			if (From == To)
+			{
+				continue;
+			}
+
+			if (NodeOperands[From] == BothOperands)
+			{
+				bHasSide = false;
+			}
+
+			bool bIsKept = false;
+			bool bIsReversed = false;
+
+			const int32* OtherFrom = (NodeOperands[From] == BothOperands && NodeOperands[To] == BothOperands) ? OtherPieces.Find(GetPieceKey(From, To)) : nullptr;
+			if (OtherFrom)
+			{
+				// Interiors are on the left of the edges : run along the same way, both operands are on the same side of the piece.
+				// The subject copy is the one kept, only once.
+				const bool bIsSameDirection = (*OtherFrom == From);
+				bIsKept = bIsSubject && ((Operation == EVectorBooleanOperation::Difference) ? !bIsSameDirection : bIsSameDirection);
+			}
+			else
+			{
+				if (!bHasSide)
+				{
+					const FVector2D Probe = (NodePoints[From] + NodePoints[To]) * 0.5f;
+					bIsInside = bIsSubject ? IsInsideOperand(Clip, ClipBounds, Probe) : IsInsideOperand(Subject, SubjectBounds, Probe);
+					bHasSide = true;
+				}
+
+				switch (Operation)
+				{
+				case EVectorBooleanOperation::Union:
+					bIsKept = !bIsInside;
+					break;
+				case EVectorBooleanOperation::Intersection:
+					bIsKept = bIsInside;
+					break;
+				case EVectorBooleanOperation::Difference:
+					// The clip boundary left inside the subject bounds the result the other way around
+					bIsKept = bIsSubject ? !bIsInside : bIsInside;
+					bIsReversed = !bIsSubject;
+					break;
+				}
+			}
+
+			if (bIsKept)
+			{
+				EdgeFrom.Add(bIsReversed ? To : From);
+				EdgeTo.Add(bIsReversed ? From : To);
+			}
+		}
+	}
+
+	// Chain the kept pieces into loops. Where result loops touch, a node has several pieces leaving it : the sharpest left turn
+	// stays on the loop that came in, and a loop is closed as soon as it is back to its first node.
+	const int32 NumEdges = EdgeFrom.Num();
+	TArray<int32> NodeFirstEdges;
+	TArray<int32> NextNodeEdges;
+	NodeFirstEdges.Init(INDEX_NONE, NodePoints.Num());
+	NextNodeEdges.SetNumUninitialized(NumEdges);
+	for (int32 EdgeIdx = 0; EdgeIdx < NumEdges; EdgeIdx++)
+	{
+		NextNodeEdges[EdgeIdx] = NodeFirstEdges[EdgeFrom[EdgeIdx]];
+		NodeFirstEdges[EdgeFrom[EdgeIdx]] = EdgeIdx;
+	}
+
+	TArray<FClippedLoop> Loops;
+	TBitArray<> UsedEdges(false, NumEdges);
+	for (int32 FirstEdge = 0; FirstEdge < NumEdges; FirstEdge++)
+	{
+		if (UsedEdges[FirstEdge])
+		{
+			continue;
+		}
+
+		TArray<FVector2D> LoopPoints;
+		for (int32 Edge = FirstEdge; Edge != INDEX_NONE; )
+		{
+			UsedEdges[Edge] = true;
+			LoopPoints.Add(NodePoints[EdgeFrom[Edge]]);
+
+			const int32 Node = EdgeTo[Edge];
+			if (Node == EdgeFrom[FirstEdge])
+			{
+				break;
+			}
+
+			const FVector2D Incoming = NodePoints[Node] - NodePoints[EdgeFrom[Edge]];
+			int32 NextEdge = INDEX_NONE;
+			double NextTurn = -MAX_dbl;
+			for (int32 Candidate = NodeFirstEdges[Node]; Candidate != INDEX_NONE; Candidate = NextNodeEdges[Candidate])
+			{
+				if (!UsedEdges[Candidate])
+				{
+					const FVector2D Outgoing = NodePoints[EdgeTo[Candidate]] - NodePoints[Node];
+					const double Turn = FMath::Atan2(Incoming ^ Outgoing, Incoming | Outgoing);
+					if (Turn > NextTurn)
+					{
+						NextTurn = Turn;
+						NextEdge = Candidate;
+					}
+				}
+			}
+			Edge = NextEdge;
+		}
+
+		CleanPolygon(LoopPoints);
+
+		const float LoopArea = Area(LoopPoints);
+		if (LoopPoints.Num() >= 3 && !FMath::IsNearlyZero(LoopArea))
+		{
+			FClippedLoop& Loop = Loops.AddDefaulted_GetRef();
+			Loop.Bounds = FBox2D(LoopPoints);
+			Loop.Points = MoveTemp(LoopPoints);
+			Loop.Area = LoopArea;
+		}
+	}
+
+	// Counter clockwise loops are contours, clockwise ones holes of the smallest contour around them
+	Loops.Sort([](const FClippedLoop& A, const FClippedLoop& B) { return FMath::Abs(A.Area) > FMath::Abs(B.Area); });
+
+	TArray<int32> LoopPolygons;
+	LoopPolygons.Init(INDEX_NONE, Loops.Num());
+	for (int32 LoopIdx = 0; LoopIdx < Loops.Num(); LoopIdx++)
+	{
+		FClippedLoop& Loop = Loops[LoopIdx];
+		if (Loop.Area > 0.0f)
+		{
+			LoopPolygons[LoopIdx] = OutPolygons.Num();
+			OutPolygons.AddDefaulted_GetRef().Contour = MoveTemp(Loop.Points);
+			continue;
+		}
+
+		const FVector2D Probe = (Loop.Points[0] + Loop.Points[1]) * 0.5f;
+		for (int32 ParentIdx = LoopIdx - 1; ParentIdx >= 0; ParentIdx--)
+		{
+			const int32 ParentPolygon = LoopPolygons[ParentIdx];
+			if (ParentPolygon != INDEX_NONE && Loops[ParentIdx].Bounds.IsInside(Probe) && IsPointInsidePolygon(OutPolygons[ParentPolygon].Contour, Probe))
+			{
+				OutPolygons[ParentPolygon].Holes.Add(MoveTemp(Loop.Points));
+				break;
+			}
+		}
+	}
+}
+
+void FPolygonTools::ConvexHull(const TArray<FVector2D>& Points, TArray<FVector2D>& OutHull)
+{
+	TArray<FVector2D> SortedPoints = Points;
+	SortedPoints.Sort([](const FVector2D& A, const FVector2D& B) { return A.X < B.X || (A.X == B.X && A.Y < B.Y); });
+
+	const int32 NumPoints = SortedPoints.Num();
+	if (NumPoints < 3)
+	{
+		OutHull = MoveTemp(SortedPoints);
+		return;
+	}
+
+	OutHull.SetNumUninitialized(2 * NumPoints, false);
+	int32 NumHull = 0;
+
+	// Lower chain left to right, then upper chain right to left, both only turning left
+	for (int32 PointIdx = 0; PointIdx < NumPoints; PointIdx++)
+	{
+		while (NumHull >= 2 && PolygonLoops::Orient(OutHull[NumHull - 2], OutHull[NumHull - 1], SortedPoints[PointIdx]) <= 0.0)
+		{
+			NumHull--;
+		}
+		OutHull[NumHull++] = SortedPoints[PointIdx];
+	}
+
+	const int32 LowerHullEnd = NumHull + 1;
+	for (int32 PointIdx = NumPoints - 2; PointIdx >= 0; PointIdx--)
+	{
+		while (NumHull >= LowerHullEnd && PolygonLoops::Orient(OutHull[NumHull - 2], OutHull[NumHull - 1], SortedPoints[PointIdx]) <= 0.0)
+		{
+			NumHull--;
+		}
+		OutHull[NumHull++] = SortedPoints[PointIdx];
+	}
+
+	// The last point closes the loop on the first one
+	OutHull.SetNum(NumHull - 1, false);
+}
+
+bool FPolygonTools::IsSplineWindingCCW(const UVectorSplineComponent* SplineComponent)
+{
+	return IsSplineWindingCCW(SplineComponent->GetSplinePointsPosition());
+}
+
+bool FPolygonTools::IsSplineWindingCCW(const FInterpCurveVector& SplinePointsPosition)
+{
+	float Sum = 0.0f;
+	const int PointCount = SplinePointsPosition.Points.Num();
+	for (int PointIndex = 0; PointIndex < PointCount; ++PointIndex)
+	{
+		const FVector& A = SplinePointsPosition.Points[PointIndex].OutVal;
+		const FVector& B = SplinePointsPosition.Points[(PointIndex + 1) % PointCount].OutVal;
+		Sum += (B.X - A.X) * (B.Y + A.Y);
+	}
+	return (Sum < 0.0f);
+}
+
+namespace PolylineSimplification
+{
+	static FORCEINLINE double DistToSegmentSquared(const FVector2D& Point, const FVector2D& SegmentA, const FVector2D& SegmentB)
+	{
+		const FVector2D Segment = SegmentB - SegmentA;
+		const double SegmentSizeSquared = Segment.SizeSquared();
+		if (SegmentSizeSquared <= UE_DOUBLE_SMALL_NUMBER)
+		{
+			return FVector2D::DistSquared(Point, SegmentA);
+		}
+
+		const double Alpha = FMath::Clamp(((Point - SegmentA) | Segment) / SegmentSizeSquared, 0.0, 1.0);
+		return FVector2D::DistSquared(Point, SegmentA + Segment * Alpha);
+	}
+}
+
+namespace AdaptiveFlattening
+{
+	/** Bounds the subdivision of degenerated segments. */
+	static constexpr int32 MaxDepth = 12;
+
+	/**
+	 * Splits the cubic Bezier in halves until its control points lie within the tolerance from its chord.
+	 * The curve lies in the hull of its control points, so its chord error is bounded as well. Adds the start of every chord, not the end of the curve.
+	 */
+	static void FlattenCubic(const FVector2D& P0, const FVector2D& P1, const FVector2D& P2, const FVector2D& P3, double ToleranceSquared, int32 Depth, TArray<FVector2D>& OutPoints)
+	{
+		if (Depth >= MaxDepth
+			|| (PolylineSimplification::DistToSegmentSquared(P1, P0, P3) <= ToleranceSquared && PolylineSimplification::DistToSegmentSquared(P2, P0, P3) <= ToleranceSquared))
+		{
+			OutPoints.Add(P0);
+			return;
+		}
+
+		// de Casteljau split at the middle
+		const FVector2D P01 = (P0 + P1) * 0.5;
+		const FVector2D P12 = (P1 + P2) * 0.5;
+		const FVector2D P23 = (P2 + P3) * 0.5;
+		const FVector2D P012 = (P01 + P12) * 0.5;
+		const FVector2D P123 = (P12 + P23) * 0.5;
+		const FVector2D Middle = (P012 + P123) * 0.5;
+
+		FlattenCubic(P0, P01, P012, Middle, ToleranceSquared, Depth + 1, OutPoints);
+		FlattenCubic(Middle, P123, P23, P3, ToleranceSquared, Depth + 1, OutPoints);
+	}
+}
+
+void FPolygonTools::SimplifyPolyline(TArrayView<const FVector2D> Polyline, float Tolerance, TArray<FVector2D>& OutPolyline, bool bAppendLastPoint)
+{
+	const int32 NumPoints = Polyline.Num();
+	if (NumPoints <= 2)
+	{
+		OutPolyline.Append(Polyline.GetData(), bAppendLastPoint ? NumPoints : FMath::Min(NumPoints, 1));
+		return;
+	}
+
+	const double ToleranceSquared = FMath::Square((double)Tolerance);
+
+	TArray<bool, TInlineAllocator<128>> KeepPoint;
+	KeepPoint.SetNumZeroed(NumPoints);
+	KeepPoint[0] = true;
+	KeepPoint[NumPoints - 1] = true;
+
+	// Ranges left to split, instead of recursing
+	TArray<TPair<int32, int32>, TInlineAllocator<64>> Ranges;
+	Ranges.Emplace(0, NumPoints - 1);
+
+	while (Ranges.Num() > 0)
+	{
+		const TPair<int32, int32> Range = Ranges.Pop(false);
+		const FVector2D& First = Polyline[Range.Key];
+		const FVector2D& Last = Polyline[Range.Value];
+
+		int32 FarthestIdx = INDEX_NONE;
+		double FarthestDistSquared = ToleranceSquared;
+		for (int32 PointIdx = Range.Key + 1; PointIdx < Range.Value; PointIdx++)
+		{
+			const double DistSquared = PolylineSimplification::DistToSegmentSquared(Polyline[PointIdx], First, Last);
+			if (DistSquared > FarthestDistSquared)
+			{
+				FarthestDistSquared = DistSquared;
+				FarthestIdx = PointIdx;
+			}
+		}
+
+		if (FarthestIdx != INDEX_NONE)
+		{
+			KeepPoint[FarthestIdx] = true;
+			Ranges.Emplace(Range.Key, FarthestIdx);
+			Ranges.Emplace(FarthestIdx, Range.Value);
+		}
+	}
+
+	const int32 NumAppended = bAppendLastPoint ? NumPoints : NumPoints - 1;
+	for (int32 PointIdx = 0; PointIdx < NumAppended; PointIdx++)
+	{
+		if (KeepPoint[PointIdx])
+		{
+			OutPolyline.Add(Polyline[PointIdx]);
+		}
+	}
+}
+
+void FPolygonTools::SimplifySplinePolygon(const FSplineCurves& SplineCurves, const FVectorShapeMeshBuildSettings& Settings, TArray<FVector2D>& OutPolygon)
+{
+	OutPolygon.Reset();
+
+	const float Tolerence = FMath::Lerp<float>(0.25f, 0.9995f, FMath::InterpExpoOut<float>(0, 1, Settings.SimplificationThreshold));
+
+	const int32 NumPoints = SplineCurves.Position.Points.Num();
+	const int32 NumSteps = Settings.bUseFixedStepsPerSegment ? Settings.StepsPerSegment : SplineCurves.ReparamTable.Points.Num();
+
+	OutPolygon.Reserve(NumPoints * FMath::Max(NumSteps, 1));
+
+	// Every step of a segment is sampled, then reduced to the points the tolerance requires. Spline points are always kept.
+	const bool bDouglasPeucker = !Settings.bPreview && Settings.SimplificationMethod == EVectorSimplificationMethod::DouglasPeucker;
+	TArray<FVector2D> SegmentSamples;
+
+	// Curved segments are subdivided from their Hermite tangents, without evaluating the curve
+	const bool bAdaptive = !Settings.bPreview && Settings.bAdaptiveFlattening;
+	const double FlatteningToleranceSquared = FMath::Square((double)FMath::Max(Settings.FlatteningTolerance, 0.01f));
+
+	FVector PreviousDirection = FVector::ZeroVector;
+
+	for (int32 PointIdx = 0; PointIdx < NumPoints; PointIdx++)
+	{
+		const bool bIsLinearPoint = !SplineCurves.Position.Points[PointIdx].IsCurveKey();
+		const  FVector LocationAtPoint = SplineCurves.Position.Points[PointIdx].OutVal;
+		const FVector DirectionAtPoint = SplineCurves.Position.Points[PointIdx].LeaveTangent.GetSafeNormal();
+
+		const bool bHasNextPoint = (PointIdx + 1 < NumPoints) || SplineCurves.Position.bIsLooped;
+		if (bAdaptive && !bIsLinearPoint && bHasNextPoint)
+		{
+			const FInterpCurvePoint<FVector>& StartPoint = SplineCurves.Position.Points[PointIdx];
+			const FInterpCurvePoint<FVector>& EndPoint = SplineCurves.Position.Points[(PointIdx + 1) % NumPoints];
+			const float KeyDiff = (PointIdx + 1 < NumPoints) ? (EndPoint.InVal - StartPoint.InVal) : SplineCurves.Position.LoopKeyOffset;
+
+			// Hermite to Bezier control points
+			const FVector2D P0(StartPoint.OutVal.X, StartPoint.OutVal.Y);
+			const FVector2D P3(EndPoint.OutVal.X, EndPoint.OutVal.Y);
+			const FVector2D P1 = P0 + FVector2D(StartPoint.LeaveTangent.X, StartPoint.LeaveTangent.Y) * (KeyDiff / 3.0f);
+			const FVector2D P2 = P3 - FVector2D(EndPoint.ArriveTangent.X, EndPoint.ArriveTangent.Y) * (KeyDiff / 3.0f);
+
+			AdaptiveFlattening::FlattenCubic(P0, P1, P2, P3, FlatteningToleranceSquared, 0, OutPolygon);
+			continue;
+		}
+
+		if (bDouglasPeucker && !bIsLinearPoint)
+		{
+			SegmentSamples.Reset(NumSteps + 1);
+			SegmentSamples.Add(FVector2D(LocationAtPoint.X, LocationAtPoint.Y));
+			for (int32 StepIdx = 1; StepIdx <= NumSteps; StepIdx++)
+			{
+				const  FVector LocationAtKey = SplineCurves.Position.Eval(PointIdx + ((float)StepIdx / float(NumSteps)), FVector::ZeroVector);
+				SegmentSamples.Add(FVector2D(LocationAtKey.X, LocationAtKey.Y));
+			}
+
+			// The segment end is the next spline point
+			SimplifyPolyline(SegmentSamples, Settings.SimplificationTolerance, OutPolygon, false);
+			continue;
+		}
+
+		OutPolygon.Add(FVector2D(LocationAtPoint.X, LocationAtPoint.Y));
+		PreviousDirection = DirectionAtPoint;
+
+		if (bIsLinearPoint == true)
+		{
+			continue;
+		}
+
+		for (int32 StepIdx = 1; StepIdx < NumSteps; StepIdx++)
+		{
+			const float CurrentKey = PointIdx + ((float)StepIdx / float(NumSteps));
+
+			const FVector DirectionAtKey = SplineCurves.Position.EvalDerivative(CurrentKey, FVector::ZeroVector).GetSafeNormal();
+
+			if (!Settings.bPreview && FVector::Coincident(PreviousDirection, DirectionAtKey, Tolerence))
+			{
+				continue;
+			}
+
+			const  FVector LocationAtKey = SplineCurves.Position.Eval(CurrentKey, FVector::ZeroVector);
+			OutPolygon.Add(FVector2D(LocationAtKey.X, LocationAtKey.Y));
+			PreviousDirection = DirectionAtKey;
+		}
+	}
+
+	// Points were added in spline order, clockwise splines are walked backwards
+	if (!IsSplineWindingCCW(SplineCurves.Position))
+	{
+		Algo::Reverse(OutPolygon);
+	}
+}
+
+
+#if !UE_BUILD_SHIPPING
+
+namespace TriangulationBenchmark
+{
+	static void MakeCounterClockwise(TArray<FVector2D>& Polygon)
+	{
+		if (FPolygonTools::Area(Polygon) < 0.0f)
+		{
+			Algo::Reverse(Polygon);
+		}
+	}
+
+	static void MakeStar(int32 NumVertices, TArray<FVector2D>& OutPolygon)
+	{
+		OutPolygon.SetNumUninitialized(NumVertices);
+		for (int32 VertIdx = 0; VertIdx < NumVertices; VertIdx++)
+		{
+			const double Angle = UE_DOUBLE_TWO_PI * VertIdx / NumVertices;
+			const double Radius = (VertIdx % 2 == 0) ? 1000.0 : 400.0;
+			OutPolygon[VertIdx] = FVector2D(FMath::Cos(Angle), FMath::Sin(Angle)) * Radius;
+		}
+		MakeCounterClockwise(OutPolygon);
+	}
+
+	/** Thick spiral arm, walked outwards along its outer edge and back along its inner edge. */
+	static void MakeSpiral(int32 NumVertices, TArray<FVector2D>& OutPolygon)
+	{
+		const int32 NumSteps = FMath::Max(NumVertices / 2, 2);
+		const double NumTurns = 8.0;
+		const double TurnSpacing = 100.0;
+		const double ArmWidth = 40.0;
+
+		OutPolygon.SetNumUninitialized(NumSteps * 2);
+		for (int32 StepIdx = 0; StepIdx < NumSteps; StepIdx++)
+		{
+			const double Angle = UE_DOUBLE_TWO_PI * NumTurns * StepIdx / (NumSteps - 1);
+			const double Radius = 50.0 + TurnSpacing * Angle / UE_DOUBLE_TWO_PI;
+			const FVector2D Direction(FMath::Cos(Angle), FMath::Sin(Angle));
+			OutPolygon[StepIdx] = Direction * (Radius + ArmWidth);
+			OutPolygon[NumSteps * 2 - 1 - StepIdx] = Direction * Radius;
+		}
+		MakeCounterClockwise(OutPolygon);
+	}
+
+	/** Coastline like outline : a circle with a radius noisy at several frequencies, which keeps it simple. */
+	static void MakeMapOutline(int32 NumVertices, TArray<FVector2D>& OutPolygon)
+	{
+		FRandomStream RandomStream(0x5eed);
+
+		TArray<double> Phases;
+		for (int32 OctaveIdx = 0; OctaveIdx < 6; OctaveIdx++)
+		{
+			Phases.Add(RandomStream.FRandRange(0.0f, UE_TWO_PI));
+		}
+
+		OutPolygon.SetNumUninitialized(NumVertices);
+		for (int32 VertIdx = 0; VertIdx < NumVertices; VertIdx++)
+		{
+			const double Angle = UE_DOUBLE_TWO_PI * VertIdx / NumVertices;
+
+			double Radius = 1000.0;
+			for (int32 OctaveIdx = 0; OctaveIdx < Phases.Num(); OctaveIdx++)
+			{
+				const double Frequency = FMath::Pow(3.0, (double)OctaveIdx + 1.0);
+				Radius += 250.0 / (OctaveIdx + 1) * FMath::Sin(Angle * Frequency + Phases[OctaveIdx]);
+			}
+			Radius += RandomStream.FRandRange(-5.0f, 5.0f);
+
+			OutPolygon[VertIdx] = FVector2D(FMath::Cos(Angle), FMath::Sin(Angle)) * Radius;
+		}
+		MakeCounterClockwise(OutPolygon);
+	}
+
+	static void Run(const TArray<FString>& Args)
+	{
+		const int32 MaxVertices = Args.Num() > 0 ? FMath::Max(100, FCString::Atoi(*Args[0])) : 100000;
+		const int32 MaxEarClippingVertices = Args.Num() > 1 ? FCString::Atoi(*Args[1]) : 10000;
+
+		struct FShape
+		{
+			const TCHAR* Name;
+			void (*Make)(int32, TArray<FVector2D>&);
+		};
+		const FShape Shapes[] = { { TEXT("star"), &MakeStar }, { TEXT("spiral"), &MakeSpiral }, { TEXT("map outline"), &MakeMapOutline } };
+
+		struct FMethod
+		{
+			const TCHAR* Name;
+			EVectorTriangulationMethod Method;
+		};
+		const FMethod Methods[] = {
+			{ TEXT("ear clipping"), EVectorTriangulationMethod::EarClipping },
+			{ TEXT("indexed ear clipping"), EVectorTriangulationMethod::IndexedEarClipping },
+			{ TEXT("monotone sweep"), EVectorTriangulationMethod::MonotoneSweep } };
+
+		TArray<FVector2D> Polygon;
+		TArray<uint32> Indices;
+
+		for (const FShape& Shape : Shapes)
+		{
+			for (int32 NumVertices = 100; NumVertices <= MaxVertices; NumVertices *= 10)
+			{
+				Shape.Make(NumVertices, Polygon);
+
+				for (const FMethod& Method : Methods)
+				{
+					if (Method.Method == EVectorTriangulationMethod::EarClipping && Polygon.Num() > MaxEarClippingVertices)
+					{
+						UE_LOG(LogVectorShape, Display, TEXT("Triangulation, %s, %d vertices, %s : skipped above %d vertices"), Shape.Name, Polygon.Num(), Method.Name, MaxEarClippingVertices);
+						continue;
+					}
+
+					Indices.Reset();
+					const double StartTime = FPlatformTime::Seconds();
+					const bool bTriangulated = FPolygonTools::TriangulatePolygon(Polygon, Indices, 0, Method.Method);
+					const double Time = FPlatformTime::Seconds() - StartTime;
+
+					UE_LOG(LogVectorShape, Display, TEXT("Triangulation, %s, %d vertices, %s : %.3f ms, %d triangles%s"),
+						Shape.Name, Polygon.Num(), Method.Name, Time * 1000.0, Indices.Num() / 3, bTriangulated ? TEXT("") : TEXT(", FAILED"));
+				}
+			}
+		}
+	}
+}
+
+static FAutoConsoleCommand BenchmarkTriangulationCommand(
+	TEXT("VectorShape.BenchmarkTriangulation"),
+	TEXT("Compares the triangulation methods on generated star, spiral and map outline polygons of 100 vertices up to the first argument (default 100000). Plain ear clipping is skipped above the second argument (default 10000)."),
+	FConsoleCommandWithArgsDelegate::CreateStatic(&TriangulationBenchmark::Run));
+
+#endif // !UE_BUILD_SHIPPING
@@ -23,9 +23,13 @@
 #include "SceneInterface.h"
 #include "MaterialDomain.h"
 #include "Materials/MaterialRenderProxy.h"
+#include "VectorShapeCustomVersion.h"
+#include "VectorShapeSerialization.h"
 
 DECLARE_CYCLE_STAT(TEXT("Create Vector Mesh Proxy"), STAT_VectorMesh_CreateSceneProxy, STATGROUP_VectorMesh);
 DECLARE_CYCLE_STAT(TEXT("Get Vector Mesh Elements"), STAT_VectorMesh_GetMeshElements, STATGROUP_VectorMesh);
+DECLARE_CYCLE_STAT(TEXT("Update Vector Mesh Section GT"), STAT_VectorMesh_UpdateSectionGT, STATGROUP_VectorMesh);
+DECLARE_CYCLE_STAT(TEXT("Update Vector Mesh Section RT"), STAT_VectorMesh_UpdateSectionRT, STATGROUP_VectorMesh);
 
 /** Class representing a single section of the VectorMesh */
 class FVectorMeshProxySection
@@ -35,15 +39,68 @@ public:
 	UMaterialInterface* Material;
 	/** Vertex buffer for this section */
 	FStaticMeshVertexBuffers VertexBuffers;
-	/** Index buffer for this section */
-	FDynamicMeshIndexBuffer32 IndexBuffer;
+	/** Index buffers for this section, only the one selected by bUse16BitIndices is initialized */
+	FDynamicMeshIndexBuffer16 IndexBuffer16;
+	FDynamicMeshIndexBuffer32 IndexBuffer32;
 	/** Vertex factory for this section */
 	FLocalVertexFactory VertexFactory;
+	/** Number of vertices and indices drawn, at most the size of the buffers */
+	int32 NumVertices;
+	int32 NumIndices;
+	/** True when every vertex of the section can be addressed with 16-bit indices */
+	bool bUse16BitIndices;
 
 	FVectorMeshProxySection(ERHIFeatureLevel::Type InFeatureLevel)
 	: Material(NULL)
 	, VertexFactory(InFeatureLevel, "FVectorMeshProxySection")
+	, NumVertices(0)
+	, NumIndices(0)
+	, bUse16BitIndices(false)
 	{}
+
+	FIndexBuffer& GetIndexBuffer()
+	{
+		return bUse16BitIndices ? static_cast<FIndexBuffer&>(IndexBuffer16) : static_cast<FIndexBuffer&>(IndexBuffer32);
+	}
+
+	const FIndexBuffer& GetIndexBuffer() const
+	{
+		return bUse16BitIndices ? static_cast<const FIndexBuffer&>(IndexBuffer16) : static_cast<const FIndexBuffer&>(IndexBuffer32);
+	}
+
+	int32 GetMaxIndices() const
+	{
+		return bUse16BitIndices ? IndexBuffer16.Indices.Num() : IndexBuffer32.Indices.Num();
+	}
+};
+
+/** Section data sent to the render thread to update a proxy section in place */
+struct FVectorMeshSectionUpdateData
+{
+	/** Section to update */
+	int32 TargetSection;
+	/** New vertex positions */
+	TArray<FVector3f> Positions;
+	/** New vertex colors */
+	TArray<FColor> Colors;
+	/** New texture coordinates */
+	TArray<FVector2f> TextureCoordinates;
+	/** New index buffer */
+	TArray<uint32> Indices;
+};
+
+/** Ranges of a section sent to the render thread, the rest of its buffers is left untouched */
+struct FVectorMeshSectionRangesUpdateData
+{
+	/** Section to update */
+	int32 TargetSection;
+	/** Ranges to rewrite, the arrays below hold their data one range after another */
+	TArray<FVectorShapeMeshSectionRange> Ranges;
+	TArray<FVector3f> Positions;
+	TArray<FColor> Colors;
+	TArray<FVector2f> TextureCoordinates;
+	/** Indices into the whole section */
+	TArray<uint32> Indices;
 };
 
 /** Vector Mesh scene proxy */
@@ -59,6 +116,7 @@ public:
 	FVectorMeshSceneProxy(UVectorMeshComponent* InComponent)
 		: FPrimitiveSceneProxy(InComponent)
 		, MaterialRelevance(InComponent->GetMaterialRelevance(GetScene().GetFeatureLevel()))
+		, bStaticDrawPath(false)
 	{
 
 		if (AVectorShapeActor* ShapeActor = Cast<AVectorShapeActor>(InComponent->GetOwner()))
@@ -68,6 +126,9 @@ public:
 
 		SetWireframeColor(InComponent->GetWireframeColor());
 
+		// Meshes that never move get their draw commands cached once by the scene
+		bStaticDrawPath = !IsMovable();
+
 
 		// Copy each section
 		const int32 NumSections = InComponent->VectorMeshSections.Num();
@@ -82,38 +143,68 @@ public:
 
 				// Copy data from vertex buffer
 				const int32 NumVerts = SrcSection.Vertices.Num();
-
-				// Allocate verts
-
-				TArray<FDynamicMeshVertex> Vertices;
-				Vertices.SetNumUninitialized(NumVerts);
+				const int32 NumIndices = SrcSection.Indices.Num();
 
 				const bool bHasUniqueTangent = (SrcSection.Tangents.Num() < SrcSection.Vertices.Num());
 				const bool bHasUniqueNormal = (SrcSection.Normals.Num() < SrcSection.Vertices.Num());
 				const bool bHasUniqueUVs = (SrcSection.TextureCoordinates.Num() < SrcSection.Vertices.Num());
 
+				FStaticMeshVertexBuffers& VertexBuffers = NewSection->VertexBuffers;
+
+				// Vector meshes only use one half precision UV channel, fill the buffers directly without a dynamic vertex staging copy
+				VertexBuffers.PositionVertexBuffer.Init(NumVerts);
+				VertexBuffers.StaticMeshVertexBuffer.SetUseFullPrecisionUVs(false);
+				VertexBuffers.StaticMeshVertexBuffer.Init(NumVerts, 1);
+				VertexBuffers.ColorVertexBuffer.Init(NumVerts);
+
 				// Copy verts
 				for (int VertIdx = 0; VertIdx < NumVerts; VertIdx++)
 				{
-					FDynamicMeshVertex& Vert = Vertices[VertIdx];
-					Vert.Position = (FVector3f)SrcSection.Vertices[VertIdx];
-					Vert.Color = (VertIdx < SrcSection.VertexColors.Num()) ? SrcSection.VertexColors[VertIdx] : FColor::White;
-					Vert.TextureCoordinate[0] = FVector2f(bHasUniqueUVs ? SrcSection.TextureCoordinates[0] : SrcSection.TextureCoordinates[VertIdx]);
-					Vert.TangentX = bHasUniqueTangent ? SrcSection.Tangents[0] : SrcSection.Tangents[VertIdx];
-					Vert.TangentZ = bHasUniqueNormal ? SrcSection.Normals[0] : SrcSection.Normals[VertIdx];
-					Vert.TangentZ.Vector.W = 127;
+					const FVector3f TangentX = (FVector3f)(bHasUniqueTangent ? SrcSection.Tangents[0] : SrcSection.Tangents[VertIdx]);
+					const FVector3f TangentZ = (FVector3f)(bHasUniqueNormal ? SrcSection.Normals[0] : SrcSection.Normals[VertIdx]);
+
+					VertexBuffers.PositionVertexBuffer.VertexPosition(VertIdx) = (FVector3f)SrcSection.Vertices[VertIdx];
+					VertexBuffers.StaticMeshVertexBuffer.SetVertexTangents(VertIdx, TangentX, TangentZ ^ TangentX, TangentZ);
+					VertexBuffers.StaticMeshVertexBuffer.SetVertexUV(VertIdx, 0, FVector2f(bHasUniqueUVs ? SrcSection.TextureCoordinates[0] : SrcSection.TextureCoordinates[VertIdx]));
+					VertexBuffers.ColorVertexBuffer.VertexColor(VertIdx) = (VertIdx < SrcSection.VertexColors.Num()) ? SrcSection.VertexColors[VertIdx] : FColor::White;
 				}
 
-				// Copy index buffer
-				NewSection->IndexBuffer.Indices = SrcSection.Indices;
+				// Copy index buffer, halving its size when the section is small enough
+				NewSection->bUse16BitIndices = (NumVerts <= MAX_uint16 + 1);
+				if (NewSection->bUse16BitIndices)
+				{
+					NewSection->IndexBuffer16.Indices.SetNumUninitialized(NumIndices);
+					for (int32 Idx = 0; Idx < NumIndices; Idx++)
+					{
+						NewSection->IndexBuffer16.Indices[Idx] = (uint16)SrcSection.Indices[Idx];
+					}
+				}
+				else
+				{
+					NewSection->IndexBuffer32.Indices = SrcSection.Indices;
+				}
 
-				NewSection->VertexBuffers.InitFromDynamicVertex(&NewSection->VertexFactory, Vertices, 4);
+				NewSection->NumVertices = NumVerts;
+				NewSection->NumIndices = NumIndices;
 
 				// Enqueue initialization of render resource
-				BeginInitResource(&NewSection->VertexBuffers.PositionVertexBuffer);
-				BeginInitResource(&NewSection->VertexBuffers.StaticMeshVertexBuffer);
-				BeginInitResource(&NewSection->VertexBuffers.ColorVertexBuffer);
-				BeginInitResource(&NewSection->IndexBuffer);
+				BeginInitResource(&VertexBuffers.PositionVertexBuffer);
+				BeginInitResource(&VertexBuffers.StaticMeshVertexBuffer);
+				BeginInitResource(&VertexBuffers.ColorVertexBuffer);
+				BeginInitResource(&NewSection->GetIndexBuffer());
+
+				ENQUEUE_RENDER_COMMAND(VectorMeshVertexFactoryInit)(
+					[VertexFactory = &NewSection->VertexFactory, VertexBuffers = &NewSection->VertexBuffers](FRHICommandListImmediate& RHICmdList)
+					{
+						FLocalVertexFactory::FDataType Data;
+						VertexBuffers->PositionVertexBuffer.BindPositionVertexBuffer(VertexFactory, Data);
+						VertexBuffers->StaticMeshVertexBuffer.BindTangentVertexBuffer(VertexFactory, Data);
+						VertexBuffers->StaticMeshVertexBuffer.BindPackedTexCoordVertexBuffer(VertexFactory, Data);
+						VertexBuffers->StaticMeshVertexBuffer.BindLightMapVertexBuffer(VertexFactory, Data, 0);
+						VertexBuffers->ColorVertexBuffer.BindColorVertexBuffer(VertexFactory, Data);
+						VertexFactory->SetData(RHICmdList, Data);
+					});
+
 				BeginInitResource(&NewSection->VertexFactory);
 
 				// Grab material
@@ -138,13 +229,246 @@ public:
 				Section->VertexBuffers.PositionVertexBuffer.ReleaseResource();
 				Section->VertexBuffers.StaticMeshVertexBuffer.ReleaseResource();
 				Section->VertexBuffers.ColorVertexBuffer.ReleaseResource();
-				Section->IndexBuffer.ReleaseResource();
+				Section->GetIndexBuffer().ReleaseResource();
 				Section->VertexFactory.ReleaseResource();
 				delete Section;
 			}
 		}
 	}
 
+	/** Whether the sections are drawn through cached static mesh draw commands in this view family. */
+	bool UseStaticDrawPath(const FSceneViewFamily& ViewFamily) const
+	{
+		return bStaticDrawPath && !IsRichView(ViewFamily) && !(AllowDebugViewmodes() && ViewFamily.EngineShowFlags.Wireframe);
+	}
+
+	void GetSectionMeshElement(const FVectorMeshProxySection* Section, FMaterialRenderProxy* MaterialProxy, bool bWireframe, FMeshBatch& Mesh) const
+	{
+		FMeshBatchElement& BatchElement = Mesh.Elements[0];
+		BatchElement.IndexBuffer = &Section->GetIndexBuffer();
+		Mesh.bWireframe = bWireframe;
+		Mesh.VertexFactory = &Section->VertexFactory;
+		Mesh.MaterialRenderProxy = MaterialProxy;
+
+		BatchElement.FirstIndex = 0;
+		BatchElement.NumPrimitives = Section->NumIndices / 3;
+		BatchElement.MinVertexIndex = 0;
+		BatchElement.MaxVertexIndex = Section->NumVertices - 1;
+		Mesh.ReverseCulling = IsLocalToWorldDeterminantNegative();
+		Mesh.Type = PT_TriangleList;
+		Mesh.DepthPriorityGroup = SDPG_World;
+		Mesh.bCanApplyViewModeOverrides = false;
+	}
+
+	/** Whether new section data fits in the buffers this proxy already allocated. Safe to call on the game thread, buffer sizes never change. */
+	bool CanUpdateSectionInPlace(int32 SectionIndex, const FVectorShapeMeshSection& SrcSection) const
+	{
+		const FVectorMeshProxySection* Section = Sections.IsValidIndex(SectionIndex) ? Sections[SectionIndex] : nullptr;
+		if (Section == nullptr || !SrcSection.IsValid())
+		{
+			return false;
+		}
+
+		// Tangents and normals are not sent with updates
+		const int32 NumVerts = SrcSection.Vertices.Num();
+		if (SrcSection.Tangents.Num() >= NumVerts || SrcSection.Normals.Num() >= NumVerts)
+		{
+			return false;
+		}
+
+		const int32 MaxVertices = Section->VertexBuffers.PositionVertexBuffer.GetNumVertices();
+		const int32 MaxIndices = Section->GetMaxIndices();
+
+		// Cached static mesh draw commands keep the primitive count of the buffers
+		if (bStaticDrawPath)
+		{
+			return NumVerts == MaxVertices && SrcSection.Indices.Num() == MaxIndices;
+		}
+
+		return NumVerts <= MaxVertices && SrcSection.Indices.Num() <= MaxIndices;
+	}
+
+	/** Whether ranges of the section can be rewritten in place : the section still has the exact size of the proxy buffers. */
+	bool CanUpdateSectionRangesInPlace(int32 SectionIndex, const FVectorShapeMeshSection& SrcSection) const
+	{
+		const FVectorMeshProxySection* Section = Sections.IsValidIndex(SectionIndex) ? Sections[SectionIndex] : nullptr;
+		if (Section == nullptr || !SrcSection.IsValid())
+		{
+			return false;
+		}
+
+		const int32 NumVerts = SrcSection.Vertices.Num();
+		if (SrcSection.Tangents.Num() >= NumVerts || SrcSection.Normals.Num() >= NumVerts)
+		{
+			return false;
+		}
+
+		return NumVerts == (int32)Section->VertexBuffers.PositionVertexBuffer.GetNumVertices() && SrcSection.Indices.Num() == Section->GetMaxIndices();
+	}
+
+	void UpdateSectionRanges_RenderThread(FRHICommandListImmediate& RHICmdList, FVectorMeshSectionRangesUpdateData* RangesData)
+	{
+		SCOPE_CYCLE_COUNTER(STAT_VectorMesh_UpdateSectionRT);
+
+		check(IsInRenderingThread());
+
+		FVectorMeshProxySection* Section = Sections.IsValidIndex(RangesData->TargetSection) ? Sections[RangesData->TargetSection] : nullptr;
+		if (Section != nullptr)
+		{
+			FPositionVertexBuffer& PositionVertexBuffer = Section->VertexBuffers.PositionVertexBuffer;
+			FColorVertexBuffer& ColorVertexBuffer = Section->VertexBuffers.ColorVertexBuffer;
+			FStaticMeshVertexBuffer& StaticMeshVertexBuffer = Section->VertexBuffers.StaticMeshVertexBuffer;
+
+			const uint32 TexCoordStride = StaticMeshVertexBuffer.GetTexCoordSize() / FMath::Max<uint32>(StaticMeshVertexBuffer.GetNumVertices(), 1);
+			const uint32 IndexStride = Section->bUse16BitIndices ? sizeof(uint16) : sizeof(uint32);
+			uint8* IndexData = Section->bUse16BitIndices ? (uint8*)Section->IndexBuffer16.Indices.GetData() : (uint8*)Section->IndexBuffer32.Indices.GetData();
+
+			// Only the bytes of the range are locked and uploaded
+			auto UploadRange = [&RHICmdList](FRHIBuffer* Buffer, const void* Data, uint32 Stride, int32 First, int32 Num)
+			{
+				if (Num > 0)
+				{
+					void* BufferData = RHICmdList.LockBuffer(Buffer, First * Stride, Num * Stride, RLM_WriteOnly);
+					FMemory::Memcpy(BufferData, (const uint8*)Data + First * Stride, Num * Stride);
+					RHICmdList.UnlockBuffer(Buffer);
+				}
+			};
+
+			int32 SourceVertex = 0;
+			int32 SourceIndex = 0;
+			for (const FVectorShapeMeshSectionRange& Range : RangesData->Ranges)
+			{
+				if (Range.FirstVertex + Range.NumVertices > (int32)PositionVertexBuffer.GetNumVertices() || Range.FirstIndex + Range.NumIndices > Section->GetMaxIndices())
+				{
+					break;
+				}
+
+				for (int32 VertIdx = 0; VertIdx < Range.NumVertices; VertIdx++)
+				{
+					const int32 DestVertex = Range.FirstVertex + VertIdx;
+					PositionVertexBuffer.VertexPosition(DestVertex) = RangesData->Positions[SourceVertex + VertIdx];
+					ColorVertexBuffer.VertexColor(DestVertex) = RangesData->Colors[SourceVertex + VertIdx];
+					StaticMeshVertexBuffer.SetVertexUV(DestVertex, 0, RangesData->TextureCoordinates[SourceVertex + VertIdx]);
+				}
+
+				for (int32 Idx = 0; Idx < Range.NumIndices; Idx++)
+				{
+					if (Section->bUse16BitIndices)
+					{
+						Section->IndexBuffer16.Indices[Range.FirstIndex + Idx] = (uint16)RangesData->Indices[SourceIndex + Idx];
+					}
+					else
+					{
+						Section->IndexBuffer32.Indices[Range.FirstIndex + Idx] = RangesData->Indices[SourceIndex + Idx];
+					}
+				}
+
+				UploadRange(PositionVertexBuffer.VertexBufferRHI, PositionVertexBuffer.GetVertexData(), PositionVertexBuffer.GetStride(), Range.FirstVertex, Range.NumVertices);
+				UploadRange(ColorVertexBuffer.VertexBufferRHI, ColorVertexBuffer.GetVertexData(), ColorVertexBuffer.GetStride(), Range.FirstVertex, Range.NumVertices);
+				UploadRange(StaticMeshVertexBuffer.TexCoordVertexBuffer.VertexBufferRHI, StaticMeshVertexBuffer.GetTexCoordData(), TexCoordStride, Range.FirstVertex, Range.NumVertices);
+				UploadRange(Section->GetIndexBuffer().IndexBufferRHI, IndexData, IndexStride, Range.FirstIndex, Range.NumIndices);
+
+				SourceVertex += Range.NumVertices;
+				SourceIndex += Range.NumIndices;
+			}
+
+			// A shrinking full update can leave the drawn counts below the buffers, ranges are only sent when the section fills them exactly
+			Section->NumVertices = PositionVertexBuffer.GetNumVertices();
+			Section->NumIndices = Section->GetMaxIndices();
+		}
+
+		// Free data sent from game thread
+		delete RangesData;
+	}
+
+	void UpdateSection_RenderThread(FRHICommandListImmediate& RHICmdList, FVectorMeshSectionUpdateData* SectionData)
+	{
+		SCOPE_CYCLE_COUNTER(STAT_VectorMesh_UpdateSectionRT);
+
+		check(IsInRenderingThread());
+
+		FVectorMeshProxySection* Section = Sections.IsValidIndex(SectionData->TargetSection) ? Sections[SectionData->TargetSection] : nullptr;
+		if (Section != nullptr)
+		{
+			const int32 NumVerts = SectionData->Positions.Num();
+			const int32 NumIndices = SectionData->Indices.Num();
+
+			FPositionVertexBuffer& PositionVertexBuffer = Section->VertexBuffers.PositionVertexBuffer;
+			FColorVertexBuffer& ColorVertexBuffer = Section->VertexBuffers.ColorVertexBuffer;
+			FStaticMeshVertexBuffer& StaticMeshVertexBuffer = Section->VertexBuffers.StaticMeshVertexBuffer;
+
+			// Iterate through vertex data, copying in new info
+			for (int32 VertIdx = 0; VertIdx < NumVerts; VertIdx++)
+			{
+				PositionVertexBuffer.VertexPosition(VertIdx) = SectionData->Positions[VertIdx];
+				ColorVertexBuffer.VertexColor(VertIdx) = SectionData->Colors[VertIdx];
+				StaticMeshVertexBuffer.SetVertexUV(VertIdx, 0, SectionData->TextureCoordinates[VertIdx]);
+			}
+
+			{
+				void* VertexBufferData = RHICmdList.LockBuffer(PositionVertexBuffer.VertexBufferRHI, 0, NumVerts * PositionVertexBuffer.GetStride(), RLM_WriteOnly);
+				FMemory::Memcpy(VertexBufferData, PositionVertexBuffer.GetVertexData(), NumVerts * PositionVertexBuffer.GetStride());
+				RHICmdList.UnlockBuffer(PositionVertexBuffer.VertexBufferRHI);
+			}
+
+			{
+				void* VertexBufferData = RHICmdList.LockBuffer(ColorVertexBuffer.VertexBufferRHI, 0, NumVerts * ColorVertexBuffer.GetStride(), RLM_WriteOnly);
+				FMemory::Memcpy(VertexBufferData, ColorVertexBuffer.GetVertexData(), NumVerts * ColorVertexBuffer.GetStride());
+				RHICmdList.UnlockBuffer(ColorVertexBuffer.VertexBufferRHI);
+			}
+
+			{
+				void* VertexBufferData = RHICmdList.LockBuffer(StaticMeshVertexBuffer.TexCoordVertexBuffer.VertexBufferRHI, 0, StaticMeshVertexBuffer.GetTexCoordSize(), RLM_WriteOnly);
+				FMemory::Memcpy(VertexBufferData, StaticMeshVertexBuffer.GetTexCoordData(), StaticMeshVertexBuffer.GetTexCoordSize());
+				RHICmdList.UnlockBuffer(StaticMeshVertexBuffer.TexCoordVertexBuffer.VertexBufferRHI);
+			}
+
+			if (Section->bUse16BitIndices)
+			{
+				for (int32 Idx = 0; Idx < NumIndices; Idx++)
+				{
+					Section->IndexBuffer16.Indices[Idx] = (uint16)SectionData->Indices[Idx];
+				}
+
+				void* IndexBufferData = RHICmdList.LockBuffer(Section->IndexBuffer16.IndexBufferRHI, 0, NumIndices * sizeof(uint16), RLM_WriteOnly);
+				FMemory::Memcpy(IndexBufferData, Section->IndexBuffer16.Indices.GetData(), NumIndices * sizeof(uint16));
+				RHICmdList.UnlockBuffer(Section->IndexBuffer16.IndexBufferRHI);
+			}
+			else
+			{
+				FMemory::Memcpy(Section->IndexBuffer32.Indices.GetData(), SectionData->Indices.GetData(), NumIndices * sizeof(uint32));
+
+				void* IndexBufferData = RHICmdList.LockBuffer(Section->IndexBuffer32.IndexBufferRHI, 0, NumIndices * sizeof(uint32), RLM_WriteOnly);
+				FMemory::Memcpy(IndexBufferData, SectionData->Indices.GetData(), NumIndices * sizeof(uint32));
+				RHICmdList.UnlockBuffer(Section->IndexBuffer32.IndexBufferRHI);
+			}
+
+			Section->NumVertices = NumVerts;
+			Section->NumIndices = NumIndices;
+		}
+
+		// Free data sent from game thread
+		delete SectionData;
+	}
+
+	virtual void DrawStaticElements(FStaticPrimitiveDrawInterface* PDI) override
+	{
+		if (!bStaticDrawPath)
+		{
+			return;
+		}
+
+		for (const FVectorMeshProxySection* Section : Sections)
+		{
+			if (Section != nullptr)
+			{
+				FMeshBatch Mesh;
+				GetSectionMeshElement(Section, Section->Material->GetRenderProxy(), false, Mesh);
+				PDI->DrawMesh(Mesh, FLT_MAX);
+			}
+		}
+	}
+
 
 	virtual void GetDynamicMeshElements(const TArray<const FSceneView*>& Views, const FSceneViewFamily& ViewFamily, uint32 VisibilityMap, FMeshElementCollector& Collector) const override
 	{
@@ -168,7 +492,8 @@ public:
 		bool bDrawSimpleCollision = false;
 		bool bDrawComplexCollision = false;
 
-		const bool bDrawMesh = true;
+		// Static meshes outside of rich views are drawn from their cached mesh draw commands
+		const bool bDrawMesh = !UseStaticDrawPath(ViewFamily);
 
 		// Draw Mesh
 		if (bDrawMesh)
@@ -188,11 +513,7 @@ public:
 							const FSceneView* View = Views[ViewIndex];
 							// Draw the mesh.
 							FMeshBatch& Mesh = Collector.AllocateMesh();
-							FMeshBatchElement& BatchElement = Mesh.Elements[0];
-							BatchElement.IndexBuffer = &Section->IndexBuffer;
-							Mesh.bWireframe = bWireframe;
-							Mesh.VertexFactory = &Section->VertexFactory;
-							Mesh.MaterialRenderProxy = MaterialProxy;
+							GetSectionMeshElement(Section, MaterialProxy, bWireframe, Mesh);
 
 							bool bHasPrecomputedVolumetricLightmap;
 							FMatrix PreviousLocalToWorld;
@@ -202,16 +523,8 @@ public:
 
 							FDynamicPrimitiveUniformBuffer& DynamicPrimitiveUniformBuffer = Collector.AllocateOneFrameResource<FDynamicPrimitiveUniformBuffer>();
 							DynamicPrimitiveUniformBuffer.Set(Collector.GetRHICommandList(), GetLocalToWorld(), PreviousLocalToWorld, GetBounds(), GetLocalBounds(), true, bHasPrecomputedVolumetricLightmap, AlwaysHasVelocity());
-							BatchElement.PrimitiveUniformBufferResource = &DynamicPrimitiveUniformBuffer.UniformBuffer;
-
-							BatchElement.FirstIndex = 0;
-							BatchElement.NumPrimitives = Section->IndexBuffer.Indices.Num() / 3;
-							BatchElement.MinVertexIndex = 0;
-							BatchElement.MaxVertexIndex = Section->VertexBuffers.PositionVertexBuffer.GetNumVertices() - 1;
-							Mesh.ReverseCulling = IsLocalToWorldDeterminantNegative();
-							Mesh.Type = PT_TriangleList;
-							Mesh.DepthPriorityGroup = SDPG_World;
-							Mesh.bCanApplyViewModeOverrides = false;
+							Mesh.Elements[0].PrimitiveUniformBufferResource = &DynamicPrimitiveUniformBuffer.UniformBuffer;
+
 							Collector.AddMesh(ViewIndex, Mesh);
 						}
 					}
@@ -265,7 +578,13 @@ public:
 		FPrimitiveViewRelevance Result;
 		Result.bDrawRelevance = IsShown(View);
 		Result.bShadowRelevance = IsShadowCast(View);
+		Result.bStaticRelevance = UseStaticDrawPath(*View->Family);
+#if !(UE_BUILD_SHIPPING || UE_BUILD_TEST)
+		// World size rect and bounds are always drawn as dynamic elements
 		Result.bDynamicRelevance = true;
+#else
+		Result.bDynamicRelevance = !Result.bStaticRelevance;
+#endif
 		Result.bRenderInMainPass = ShouldRenderInMainPass();
 		Result.bUsesLightingChannels = GetLightingChannelMask() != GetDefaultLightingChannelMask();
 		Result.bRenderCustomDepth = ShouldRenderCustomDepth();
@@ -294,12 +613,121 @@ private:
 	TArray<FVectorMeshProxySection*> Sections;
 	FMaterialRelevance MaterialRelevance;
 	FVector2D WorldSize;
+	bool bStaticDrawPath;
 
 };
 
 //////////////////////////////////////////////////////////////////////////
 
 
+bool FVectorShapeMeshSection::Serialize(FArchive& Ar)
+{
+	Ar.UsingCustomVersion(FVectorShapeCustomVersion::GUID);
+
+	if (!(Ar.IsLoading() || Ar.IsSaving()) || !FVectorShapeCustomVersion::IsAtLeast(Ar, FVectorShapeCustomVersion::BulkSerializedMeshData))
+	{
+		return false;
+	}
+
+	// The slack of spline ranges only speeds up editing, saved and cooked sections are compacted
+	if (Ar.IsSaving() && Ar.IsPersistent())
+	{
+		FVectorShapeMeshSection CompactedSection(*this);
+		CompactedSection.Compact();
+		CompactedSection.SerializeBulkData(Ar, VectorShapeSerialization::ShouldCompressBulkData(Ar));
+		return true;
+	}
+
+	SerializeBulkData(Ar, VectorShapeSerialization::ShouldCompressBulkData(Ar));
+	return true;
+}
+
+void FVectorShapeMeshSection::SerializeBulkData(FArchive& Ar, bool bCompress)
+{
+	VectorShapeSerialization::SerializeBulkBlock(Ar, bCompress, [this](FArchive& BlockAr)
+	{
+		Vertices.BulkSerialize(BlockAr);
+		TextureCoordinates.BulkSerialize(BlockAr);
+		Indices.BulkSerialize(BlockAr);
+		Normals.BulkSerialize(BlockAr);
+		Tangents.BulkSerialize(BlockAr);
+		VertexColors.BulkSerialize(BlockAr);
+	});
+
+	Ar << SectionLocalBox;
+}
+
+
+void FVectorShapeMeshSection::Compact()
+{
+	const int32 NumVertices = Vertices.Num();
+	const bool bHasVertexTexCoords = TextureCoordinates.Num() == NumVertices;
+	const bool bHasVertexColors = VertexColors.Num() == NumVertices;
+
+	TArray<int32> VertexRemap;
+	VertexRemap.Init(INDEX_NONE, NumVertices);
+
+	int32 NumKeptIndices = 0;
+	for (int32 Idx = 0; Idx + 2 < Indices.Num(); Idx += 3)
+	{
+		const uint32 A = Indices[Idx + 0];
+		const uint32 B = Indices[Idx + 1];
+		const uint32 C = Indices[Idx + 2];
+		if (A == B && B == C)
+		{
+			continue;
+		}
+
+		Indices[NumKeptIndices++] = A;
+		Indices[NumKeptIndices++] = B;
+		Indices[NumKeptIndices++] = C;
+		VertexRemap[A] = VertexRemap[B] = VertexRemap[C] = 0;
+	}
+	Indices.SetNum(NumKeptIndices, false);
+
+	int32 NumKeptVertices = 0;
+	for (int32 VertIdx = 0; VertIdx < NumVertices; VertIdx++)
+	{
+		if (VertexRemap[VertIdx] == INDEX_NONE)
+		{
+			continue;
+		}
+
+		VertexRemap[VertIdx] = NumKeptVertices;
+		Vertices[NumKeptVertices] = Vertices[VertIdx];
+		if (bHasVertexTexCoords)
+		{
+			TextureCoordinates[NumKeptVertices] = TextureCoordinates[VertIdx];
+		}
+		if (bHasVertexColors)
+		{
+			VertexColors[NumKeptVertices] = VertexColors[VertIdx];
+		}
+		NumKeptVertices++;
+	}
+
+	if (NumKeptVertices == NumVertices)
+	{
+		return;
+	}
+
+	Vertices.SetNum(NumKeptVertices, false);
+	if (bHasVertexTexCoords)
+	{
+		TextureCoordinates.SetNum(NumKeptVertices, false);
+	}
+	if (bHasVertexColors)
+	{
+		VertexColors.SetNum(NumKeptVertices, false);
+	}
+
+	for (uint32& Index : Indices)
+	{
+		Index = VertexRemap[Index];
+	}
+}
+
+
 UVectorMeshComponent::UVectorMeshComponent(const FObjectInitializer& ObjectInitializer)
 : Super(ObjectInitializer)
 {
@@ -352,12 +780,155 @@ void UVectorMeshComponent::ClearMeshSections(bool bMarkDirty)
 	MarkRenderStateDirty();
 }
 
+void UVectorMeshComponent::SetMeshSections(TArray<FVectorShapeMeshSection>&& InMeshSections)
+{
+	VectorMeshSections = MoveTemp(InMeshSections);
+	MarkMeshDirty();
+}
+
 void UVectorMeshComponent::MarkMeshDirty()
 {
 	UpdateLocalBounds();
 	MarkRenderStateDirty();
 }
 
+void UVectorMeshComponent::UpdateMeshSection(int32 SectionIndex, const TArray<FVector>& Vertices, const TArray<FColor>& VertexColors, const TArray<uint32>& Indices)
+{
+	if (!VectorMeshSections.IsValidIndex(SectionIndex))
+	{
+		return;
+	}
+
+	FVectorShapeMeshSection& Section = VectorMeshSections[SectionIndex];
+	Section.Vertices = Vertices;
+	Section.VertexColors = VertexColors;
+	Section.Indices = Indices;
+
+	// Texture coordinates follow positions across the world size
+	if (AVectorShapeActor* ShapeActor = Cast<AVectorShapeActor>(GetOwner()))
+	{
+		const int32 NumVerts = Vertices.Num();
+		Section.TextureCoordinates.SetNumUninitialized(NumVerts);
+		for (int32 VertIdx = 0; VertIdx < NumVerts; VertIdx++)
+		{
+			Section.TextureCoordinates[VertIdx] = FVector2D(Vertices[VertIdx].X, Vertices[VertIdx].Y) / ShapeActor->WorldSize;
+		}
+	}
+	else if (Section.TextureCoordinates.Num() != Vertices.Num())
+	{
+		Section.TextureCoordinates.Reset(1);
+		Section.TextureCoordinates.Add(FVector2D(1.f, 1.f));
+	}
+
+	Section.SectionLocalBox = FBox(Vertices);
+
+	MarkMeshSectionDirty(SectionIndex);
+}
+
+void UVectorMeshComponent::MarkMeshSectionDirty(int32 SectionIndex)
+{
+	SCOPE_CYCLE_COUNTER(STAT_VectorMesh_UpdateSectionGT);
+
+	if (!VectorMeshSections.IsValidIndex(SectionIndex))
+	{
+		return;
+	}
+
+	const FVectorShapeMeshSection& Section = VectorMeshSections[SectionIndex];
+
+	FVectorMeshSceneProxy* VectorMeshProxy = static_cast<FVectorMeshSceneProxy*>(SceneProxy);
+	if (VectorMeshProxy == nullptr || !VectorMeshProxy->CanUpdateSectionInPlace(SectionIndex, Section))
+	{
+		MarkMeshDirty();
+		return;
+	}
+
+	// Bounds may have changed, this only sends a transform update to the proxy
+	UpdateLocalBounds();
+
+	// Create data to update section
+	FVectorMeshSectionUpdateData* SectionData = new FVectorMeshSectionUpdateData;
+	SectionData->TargetSection = SectionIndex;
+
+	const int32 NumVerts = Section.Vertices.Num();
+	const bool bHasUniqueUVs = (Section.TextureCoordinates.Num() < NumVerts);
+
+	SectionData->Positions.SetNumUninitialized(NumVerts);
+	SectionData->Colors.SetNumUninitialized(NumVerts);
+	SectionData->TextureCoordinates.SetNumUninitialized(NumVerts);
+	for (int32 VertIdx = 0; VertIdx < NumVerts; VertIdx++)
+	{
+		SectionData->Positions[VertIdx] = (FVector3f)Section.Vertices[VertIdx];
+		SectionData->Colors[VertIdx] = (VertIdx < Section.VertexColors.Num()) ? Section.VertexColors[VertIdx] : FColor::White;
+		SectionData->TextureCoordinates[VertIdx] = FVector2f(bHasUniqueUVs ? Section.TextureCoordinates[0] : Section.TextureCoordinates[VertIdx]);
+	}
+	SectionData->Indices = Section.Indices;
+
+	// Enqueue command to send to render thread
+	ENQUEUE_RENDER_COMMAND(FVectorMeshSectionUpdate)(
+		[VectorMeshProxy, SectionData](FRHICommandListImmediate& RHICmdList)
+		{
+			VectorMeshProxy->UpdateSection_RenderThread(RHICmdList, SectionData);
+		});
+}
+
+void UVectorMeshComponent::MarkMeshSectionRangesDirty(int32 SectionIndex, const TArray<FVectorShapeMeshSectionRange>& Ranges)
+{
+	SCOPE_CYCLE_COUNTER(STAT_VectorMesh_UpdateSectionGT);
+
+	if (!VectorMeshSections.IsValidIndex(SectionIndex) || Ranges.Num() == 0)
+	{
+		return;
+	}
+
+	const FVectorShapeMeshSection& Section = VectorMeshSections[SectionIndex];
+
+	FVectorMeshSceneProxy* VectorMeshProxy = static_cast<FVectorMeshSceneProxy*>(SceneProxy);
+	if (VectorMeshProxy == nullptr || !VectorMeshProxy->CanUpdateSectionRangesInPlace(SectionIndex, Section))
+	{
+		MarkMeshDirty();
+		return;
+	}
+
+	// Bounds may have changed, this only sends a transform update to the proxy
+	UpdateLocalBounds();
+
+	FVectorMeshSectionRangesUpdateData* RangesData = new FVectorMeshSectionRangesUpdateData;
+	RangesData->TargetSection = SectionIndex;
+	RangesData->Ranges = Ranges;
+
+	int32 NumVerts = 0;
+	int32 NumIndices = 0;
+	for (const FVectorShapeMeshSectionRange& Range : Ranges)
+	{
+		NumVerts += Range.NumVertices;
+		NumIndices += Range.NumIndices;
+	}
+
+	RangesData->Positions.Reserve(NumVerts);
+	RangesData->Colors.Reserve(NumVerts);
+	RangesData->TextureCoordinates.Reserve(NumVerts);
+	RangesData->Indices.Reserve(NumIndices);
+
+	const bool bHasUniqueUVs = (Section.TextureCoordinates.Num() < Section.Vertices.Num());
+	for (const FVectorShapeMeshSectionRange& Range : Ranges)
+	{
+		for (int32 VertIdx = Range.FirstVertex; VertIdx < Range.FirstVertex + Range.NumVertices; VertIdx++)
+		{
+			RangesData->Positions.Add((FVector3f)Section.Vertices[VertIdx]);
+			RangesData->Colors.Add((VertIdx < Section.VertexColors.Num()) ? Section.VertexColors[VertIdx] : FColor::White);
+			RangesData->TextureCoordinates.Add(FVector2f(bHasUniqueUVs ? Section.TextureCoordinates[0] : Section.TextureCoordinates[VertIdx]));
+		}
+		RangesData->Indices.Append(Section.Indices.GetData() + Range.FirstIndex, Range.NumIndices);
+	}
+
+	ENQUEUE_RENDER_COMMAND(FVectorMeshSectionRangesUpdate)(
+		[VectorMeshProxy, RangesData](FRHICommandListImmediate& RHICmdList)
+		{
+			VectorMeshProxy->UpdateSectionRanges_RenderThread(RHICmdList, RangesData);
+		});
+}
+
 void UVectorMeshComponent::UpdateLocalBounds()
 {
 	FBox LocalBox(ForceInit);
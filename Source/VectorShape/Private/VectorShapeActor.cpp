@@ -4,11 +4,8 @@
 
 #include "VectorShapeActor.h"
 #include "VectorMeshComponent.h"
-
-
-#if WITH_EDITOR
 #include "VectorSplineComponent.h"
-#endif //WITH_EDITOR
+#include "VectorShapeMeshBuilder.h"
 
 #include "UObject/ConstructorHelpers.h"
 
@@ -17,6 +14,22 @@
 AVectorShapeActor::AVectorShapeActor(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
 	, WorldSize(FVector2D(100,100))
+	, bDrawMesh(true)
+	, LineDefaultWidth(100.0f)
+	, SimplificationThreshold(0.98f)
+	, SimplificationMethod(EVectorSimplificationMethod::TangentDirection)
+	, SimplificationTolerance(0.5f)
+	, bAdaptiveFlattening(false)
+	, FlatteningTolerance(0.25f)
+	, bUseFixedStepsPerSegment(true)
+	, StepsPerSegment(20)
+	, TriangulationMethod(EVectorTriangulationMethod::EarClipping)
+	, FillRule(EVectorFillRule::NonZero)
+	, bRemoveHiddenGeometry(false)
+	, bRebuildAtRuntime(false)
+	, bBuildAsync(false)
+	, bAsyncMeshBuildPending(false)
+	, bAsyncMeshBuildPendingPreview(false)
 #if WITH_EDITORONLY_DATA
 	, SlateVectorData(nullptr)
 	, bDrawDebugSplines(true)
@@ -25,11 +38,6 @@ AVectorShapeActor::AVectorShapeActor(const FObjectInitializer& ObjectInitializer
 	, NewSplineSpawnPoint(0.f, 0.f, 0.f)
 	, NewSplineExtent(100.0, 100.0f)
 	, SplineDefaultColor(FColor::White)
-	, bDrawMesh(true)
-	, LineDefaultWidth(100.0f)
-	, SimplificationThreshold(0.98f)
-	, bUseFixedStepsPerSegment(true)
-	, StepsPerSegment(20)
 #endif //WITH_EDITOR
 {
 	MeshComponent = CreateDefaultSubobject<UVectorMeshComponent>(TEXT("MeshComponent0"));
@@ -44,6 +52,12 @@ void AVectorShapeActor::OnConstruction(const FTransform& Transform)
 	CheckTransform();
 }
 
+void AVectorShapeActor::BeginDestroy()
+{
+	FVectorShapeMeshBuilder::CancelAsyncBuild(this);
+
+	Super::BeginDestroy();
+}
 
 
 
@@ -57,6 +71,8 @@ void AVectorShapeActor::PostEditChangeProperty(FPropertyChangedEvent& PropertyCh
 	CheckTransform();
 
 	SimplificationThreshold = FMath::Clamp<float>(SimplificationThreshold, 0.0f, 1.0f);
+	SimplificationTolerance = FMath::Max<float>(SimplificationTolerance, 0.0f);
+	FlatteningTolerance = FMath::Max<float>(FlatteningTolerance, 0.01f);
 
 	//
 	NewSplineSpawnPoint.Z = FMath::Max<float>(NewSplineSpawnPoint.Z, 0.0f);
@@ -81,26 +97,57 @@ void AVectorShapeActor::PostEditChangeProperty(FPropertyChangedEvent& PropertyCh
 			{
 				//
 				VectorSplineComp->SetDrawDebug(bDrawDebugSplines);
-
-				//
-				if (!VectorSplineComp->bIsEditorOnly)
-				{
-					VectorSplineComp->bIsEditorOnly = true;
-				}
 			}
 		}
 	}
 
 
 	RebuildVectorShapeMesh();
+
+	// The world size is baked into the scene proxy, other edits are updated in place by the rebuild. Editing X or Y reports the member as WorldSize.
+	const FName WorldSizeName = GET_MEMBER_NAME_CHECKED(AVectorShapeActor, WorldSize);
+	if (PropertyChangedEvent.GetPropertyName() == WorldSizeName || PropertyChangedEvent.GetMemberPropertyName() == WorldSizeName)
+	{
+		MeshComponent->MarkMeshDirty();
+	}
 }
 
+#endif //WITH_EDITOR
+
 void AVectorShapeActor::RebuildVectorShapeMesh()
 {
-	FVectorShapeEditorDelegates::OnCreateVectorMeshDelegate.Broadcast(this);
+	if (bBuildAsync)
+	{
+		FVectorShapeMeshBuilder::BuildVectorShapeMeshAsync(this);
+	}
+	else
+	{
+		FVectorShapeMeshBuilder::BuildVectorShapeMesh(this);
+	}
 }
 
-#endif //WITH_EDITOR
+void AVectorShapeActor::RequestPreviewMeshRebuild()
+{
+	FVectorShapeMeshBuilder::RequestPreviewBuild(this);
+}
+
+FVectorShapeMeshBuildSettings AVectorShapeActor::GetMeshBuildSettings() const
+{
+	FVectorShapeMeshBuildSettings Settings;
+	Settings.WorldSize = WorldSize;
+	Settings.LineDefaultWidth = LineDefaultWidth;
+	Settings.SimplificationThreshold = SimplificationThreshold;
+	Settings.SimplificationMethod = SimplificationMethod;
+	Settings.SimplificationTolerance = SimplificationTolerance;
+	Settings.bAdaptiveFlattening = bAdaptiveFlattening;
+	Settings.FlatteningTolerance = FlatteningTolerance;
+	Settings.bUseFixedStepsPerSegment = bUseFixedStepsPerSegment;
+	Settings.StepsPerSegment = StepsPerSegment;
+	Settings.TriangulationMethod = TriangulationMethod;
+	Settings.FillRule = FillRule;
+	Settings.bRemoveHiddenGeometry = bRemoveHiddenGeometry;
+	return Settings;
+}
 
 
 void AVectorShapeActor::CheckTransform()
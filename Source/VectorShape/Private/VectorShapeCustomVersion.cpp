@@ -0,0 +1,12 @@
+//==========================================================================//
+// Copyright Elhoussine Mehnik (ue4resources@gmail.com). All Rights Reserved.
+//================== http://unrealengineresources.com/ =====================//
+
+#include "VectorShapeCustomVersion.h"
+#include "Serialization/CustomVersion.h"
+
+
+const FGuid FVectorShapeCustomVersion::GUID(0xF5A48EF0, 0xD1D14255, 0xA74F9335, 0xA611CCCB);
+
+// Register the custom version with core
+FCustomVersionRegistration GRegisterVectorShapeCustomVersion(FVectorShapeCustomVersion::GUID, FVectorShapeCustomVersion::LatestVersion, TEXT("VectorShapeVer"));
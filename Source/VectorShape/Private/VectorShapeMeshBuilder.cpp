@@ -0,0 +1,1381 @@
+//==========================================================================//
+// Copyright Elhoussine Mehnik (ue4resources@gmail.com). All Rights Reserved.
+//================== http://unrealengineresources.com/ =====================//
+
+#include "VectorShapeMeshBuilder.h"
+#include "VectorShapeActor.h"
+#include "VectorSplineComponent.h"
+#include "VectorMeshComponent.h"
+#include "PolygonTools/VectorPolygonTools.h"
+
+#include "Async/ParallelFor.h"
+#include "HAL/IConsoleManager.h"
+#include "Async/Async.h"
+#include "Tasks/Task.h"
+#include "Containers/Ticker.h"
+#include "Algo/StableSort.h"
+#include "Algo/Reverse.h"
+
+#include <atomic>
+
+
+DECLARE_CYCLE_STAT(TEXT("Flatten Splines"), STAT_VectorMesh_FlattenSplines, STATGROUP_VectorMesh);
+DECLARE_CYCLE_STAT(TEXT("Build Spline Geometry"), STAT_VectorMesh_BuildGeometry, STATGROUP_VectorMesh);
+DECLARE_CYCLE_STAT(TEXT("Assemble Mesh Section"), STAT_VectorMesh_AssembleSection, STATGROUP_VectorMesh);
+DECLARE_CYCLE_STAT(TEXT("Snapshot Splines"), STAT_VectorMesh_SnapshotSplines, STATGROUP_VectorMesh);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Coalesced Async Builds"), STAT_VectorMesh_CoalescedAsyncBuilds, STATGROUP_VectorMesh);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Coalesced Preview Builds"), STAT_VectorMesh_CoalescedPreviewBuilds, STATGROUP_VectorMesh);
+
+
+static TAutoConsoleVariable<int32> CVarVectorShapePreviewStepsPerSegment(
+	TEXT("VectorShape.PreviewStepsPerSegment"),
+	4,
+	TEXT("Steps per spline segment of the preview meshes built while splines are dragged in the editor."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarVectorShapeSplineRangeSlack(
+	TEXT("VectorShape.SplineRangeSlack"),
+	0.25f,
+	TEXT("Extra vertex capacity given to each spline range of a mesh section, as a fraction of its vertex count.\n")
+	TEXT("A spline whose vertex or index count changes within its capacity is spliced back into the section instead of rebuilding it.\n")
+	TEXT("Only previews and editor builds get slack, it is compacted away when the mesh is saved. 0 disables the slack."),
+	ECVF_Default);
+
+
+/** Snapshot of the splines of an actor and the mesh built from it on a background task. */
+class FVectorShapeAsyncMeshBuild
+{
+public:
+	TWeakObjectPtr<AVectorShapeActor> Actor;
+	FVectorShapeMeshBuildSettings Settings;
+
+	/** Copies of the spline curves and mesh caches, the build data points into them. */
+	TArray<FSplineCurves> SplineCurves;
+	TArray<FVectorSplineMeshCache> MeshCaches;
+	TArray<FVectorSplineBuildData> Splines;
+
+	TArray<FVectorShapeMeshSection> MeshSections;
+	TArray<TArray<TWeakObjectPtr<UVectorSplineComponent>>> MeshSplineLayout;
+	FVectorShapeMeshBuildReport Report;
+
+	std::atomic<bool> bCancelled { false };
+};
+
+
+namespace VectorMeshBuild
+{
+	/** Actors waiting for a preview build, and the ticker building them. */
+	static TSet<TWeakObjectPtr<AVectorShapeActor>> PendingPreviewBuilds;
+	static FTSTicker::FDelegateHandle PreviewBuildsTickerHandle;
+}
+
+
+FVectorSplineBuildData::FVectorSplineBuildData()
+	: SplineCurves(nullptr)
+	, MeshCache(nullptr)
+	, SplineColor(FColor::White)
+	, OffsetZ(0.0f)
+	, SplineType(EVectorSplineType::Polygon)
+	, bIsHole(false)
+	, BooleanMode(EVectorSplineBooleanMode::Layer)
+	, MaterialSlot(0)
+{
+}
+
+FVectorSplineBuildData::FVectorSplineBuildData(UVectorSplineComponent* InSplineComponent)
+	: SplineCurves(&InSplineComponent->SplineCurves)
+	, MeshCache(&InSplineComponent->MeshCache)
+	, SplineComponent(InSplineComponent)
+	, SplineName(InSplineComponent->GetFName())
+	, SplineColor(InSplineComponent->SplineColor)
+	, OffsetZ(InSplineComponent->OffsetZ)
+	, SplineType(InSplineComponent->SplineType)
+	, bIsHole(InSplineComponent->bIsHole)
+	, BooleanMode(InSplineComponent->BooleanMode)
+	, MaterialSlot(InSplineComponent->MaterialSlot)
+{
+}
+
+
+namespace VectorMeshBuild
+{
+	static void GatherSplines(AVectorShapeActor* VectorShapeActor, TArray<UVectorSplineComponent*>& OutSplines)
+	{
+		TInlineComponentArray<UVectorSplineComponent*> SplineComps(VectorShapeActor);
+		OutSplines.Reset(SplineComps.Num());
+		for (UVectorSplineComponent* Spline2DComponent : SplineComps)
+		{
+			if (!Spline2DComponent->bDrawMesh)
+			{
+				continue;
+			}
+
+			{
+				Spline2DComponent->CheckSpline();
+			}
+
+			OutSplines.Add(Spline2DComponent);
+		}
+	}
+
+	static uint32 GetContourHash(const FVectorShapeMeshBuildSettings& Settings, const FVectorSplineBuildData& Spline)
+	{
+		const FSplineCurves& SplineCurves = *Spline.SplineCurves;
+
+		uint32 Hash = GetTypeHash(Spline.SplineType);
+		Hash = HashCombine(Hash, GetTypeHash(Settings.SimplificationThreshold));
+		Hash = HashCombine(Hash, GetTypeHash(Settings.SimplificationMethod));
+		Hash = HashCombine(Hash, GetTypeHash(Settings.SimplificationTolerance));
+		Hash = HashCombine(Hash, GetTypeHash(Settings.bAdaptiveFlattening));
+		Hash = HashCombine(Hash, GetTypeHash(Settings.FlatteningTolerance));
+		Hash = HashCombine(Hash, GetTypeHash(Settings.bUseFixedStepsPerSegment));
+		Hash = HashCombine(Hash, GetTypeHash(Settings.StepsPerSegment));
+		Hash = HashCombine(Hash, GetTypeHash(Settings.bPreview));
+		Hash = HashCombine(Hash, GetTypeHash(SplineCurves.ReparamTable.Points.Num()));
+		Hash = HashCombine(Hash, GetTypeHash(SplineCurves.Position.bIsLooped));
+
+		for (const FInterpCurvePoint<FVector>& Point : SplineCurves.Position.Points)
+		{
+			Hash = HashCombine(Hash, GetTypeHash(Point.InVal));
+			Hash = HashCombine(Hash, GetTypeHash(Point.OutVal));
+			Hash = HashCombine(Hash, GetTypeHash(Point.ArriveTangent));
+			Hash = HashCombine(Hash, GetTypeHash(Point.LeaveTangent));
+			Hash = HashCombine(Hash, GetTypeHash(Point.InterpMode));
+		}
+
+		return Hash;
+	}
+
+	static uint32 GetGeometryHash(const FVectorShapeMeshBuildSettings& Settings, const FVectorSplineBuildData& Spline, const TArray<FVectorSplineBuildData*>& HoleSplines)
+	{
+		uint32 Hash = HashCombine(Spline.MeshCache->ContourHash, GetTypeHash(Spline.SplineColor));
+		Hash = HashCombine(Hash, GetTypeHash(Spline.OffsetZ));
+		Hash = HashCombine(Hash, GetTypeHash(Settings.WorldSize));
+
+		if (Spline.SplineType == EVectorSplineType::Line)
+		{
+			// Stroke width follows the spline scale
+			Hash = HashCombine(Hash, GetTypeHash(Settings.LineDefaultWidth));
+			for (const FInterpCurvePoint<FVector>& Point : Spline.SplineCurves->Scale.Points)
+			{
+				Hash = HashCombine(Hash, GetTypeHash(Point.InVal));
+				Hash = HashCombine(Hash, GetTypeHash(Point.OutVal));
+			}
+		}
+		else
+		{
+			Hash = HashCombine(Hash, GetTypeHash(Settings.TriangulationMethod));
+			Hash = HashCombine(Hash, GetTypeHash(Settings.FillRule));
+			for (const FVectorSplineBuildData* HoleSpline : HoleSplines)
+			{
+				Hash = HashCombine(Hash, HoleSpline->MeshCache->ContourHash);
+			}
+		}
+
+		return Hash;
+	}
+
+	/** Vertices of slack capacity a spline range gets, indices get three times as many. Game builds get none, the padding would be drawn every frame. */
+	static int32 GetRangeSlack(const FVectorShapeMeshBuildSettings& Settings, int32 NumVertices)
+	{
+		if (!Settings.bPreview && (!GIsEditor || IsRunningCommandlet()))
+		{
+			return 0;
+		}
+
+		const float Slack = CVarVectorShapeSplineRangeSlack.GetValueOnAnyThread();
+		return (Slack > 0.0f) ? FMath::CeilToInt(NumVertices * Slack) + 4 : 0;
+	}
+
+	/** Copies the spline geometry into its range, the unused capacity is filled with vertices stacked on the first one and degenerate triangles. */
+	static void CopySplineGeometryToSection(const FVectorSplineMeshCache& MeshCache, FVectorShapeMeshSection* MeshSection)
+	{
+		const int32 FirstVertex = MeshCache.SectionFirstVertex;
+		const int32 FirstIndex = MeshCache.SectionFirstIndex;
+		const int32 NumVertices = MeshCache.Vertices.Num();
+		const int32 NumIndices = MeshCache.Indices.Num();
+
+		FMemory::Memcpy(MeshSection->Vertices.GetData() + FirstVertex, MeshCache.Vertices.GetData(), NumVertices * MeshCache.Vertices.GetTypeSize());
+		FMemory::Memcpy(MeshSection->TextureCoordinates.GetData() + FirstVertex, MeshCache.TextureCoordinates.GetData(), MeshCache.TextureCoordinates.Num() * MeshCache.TextureCoordinates.GetTypeSize());
+		FMemory::Memcpy(MeshSection->VertexColors.GetData() + FirstVertex, MeshCache.VertexColors.GetData(), MeshCache.VertexColors.Num() * MeshCache.VertexColors.GetTypeSize());
+
+		for (int32 Idx = 0; Idx < NumIndices; Idx++)
+		{
+			MeshSection->Indices[FirstIndex + Idx] = MeshCache.Indices[Idx] + FirstVertex;
+		}
+
+		const FVector SlackVertex = (NumVertices > 0) ? MeshCache.Vertices[0] : FVector::ZeroVector;
+		for (int32 VertIdx = FirstVertex + NumVertices; VertIdx < FirstVertex + MeshCache.SectionNumVertices; VertIdx++)
+		{
+			MeshSection->Vertices[VertIdx] = SlackVertex;
+			MeshSection->TextureCoordinates[VertIdx] = FVector2D::ZeroVector;
+			MeshSection->VertexColors[VertIdx] = FColor::Transparent;
+		}
+
+		for (int32 Idx = FirstIndex + NumIndices; Idx < FirstIndex + MeshCache.SectionNumIndices; Idx++)
+		{
+			MeshSection->Indices[Idx] = FirstVertex;
+		}
+	}
+
+	/**
+	 * Overwrites the ranges of the splines whose geometry changed, provided the section still has the layout of the previous build
+	 * and every spline still fits in the capacity of its range. The ranges overwritten are added to OutDirtyRanges.
+	 */
+	static bool SpliceChangedSplines(TArray<TWeakObjectPtr<UVectorSplineComponent>>& SectionLayout, FVectorShapeMeshSection* MeshSection, const TArray<FVectorSplineBuildData*>& Splines, TArray<FVectorShapeMeshSectionRange>& OutDirtyRanges)
+	{
+		OutDirtyRanges.Reset();
+
+		if (SectionLayout.Num() != Splines.Num())
+		{
+			return false;
+		}
+
+		int32 NumVertices = 0;
+		int32 NumIndices = 0;
+		for (int32 SplineIdx = 0; SplineIdx < Splines.Num(); SplineIdx++)
+		{
+			const FVectorSplineMeshCache& MeshCache = *Splines[SplineIdx]->MeshCache;
+			if (SectionLayout[SplineIdx] != Splines[SplineIdx]->SplineComponent
+				|| !MeshCache.IsPlacedInSection()
+				|| MeshCache.SectionFirstVertex != NumVertices
+				|| MeshCache.SectionFirstIndex != NumIndices)
+			{
+				return false;
+			}
+
+			NumVertices += MeshCache.SectionNumVertices;
+			NumIndices += MeshCache.SectionNumIndices;
+		}
+
+		if (MeshSection->Vertices.Num() != NumVertices
+			|| MeshSection->TextureCoordinates.Num() != NumVertices
+			|| MeshSection->VertexColors.Num() != NumVertices
+			|| MeshSection->Indices.Num() != NumIndices)
+		{
+			return false;
+		}
+
+		TArray<FVectorSplineMeshCache*> ChangedCaches;
+		for (const FVectorSplineBuildData* Spline : Splines)
+		{
+			FVectorSplineMeshCache& MeshCache = *Spline->MeshCache;
+			if (MeshCache.bGeometryChanged)
+			{
+				ChangedCaches.Add(&MeshCache);
+				OutDirtyRanges.Add({ MeshCache.SectionFirstVertex, MeshCache.SectionNumVertices, MeshCache.SectionFirstIndex, MeshCache.SectionNumIndices });
+			}
+		}
+
+		if (ChangedCaches.Num() == 0)
+		{
+			return true;
+		}
+
+		ParallelFor(ChangedCaches.Num(), [&](int32 ChangedIdx)
+		{
+			CopySplineGeometryToSection(*ChangedCaches[ChangedIdx], MeshSection);
+			ChangedCaches[ChangedIdx]->bGeometryChanged = false;
+		});
+
+		MeshSection->SectionLocalBox.Init();
+		for (const FVectorSplineBuildData* Spline : Splines)
+		{
+			MeshSection->SectionLocalBox += Spline->MeshCache->LocalBox;
+		}
+
+		return true;
+	}
+
+	static void RebuildSection(TArray<TWeakObjectPtr<UVectorSplineComponent>>& SectionLayout, FVectorShapeMeshSection* MeshSection, const TArray<FVectorSplineBuildData*>& Splines, const FVectorShapeMeshBuildSettings& Settings)
+	{
+		MeshSection->Reset();
+
+		// Prefix sum of the spline ranges, each one with room to grow so later changes can be spliced in
+		int32 NumVertices = 0;
+		int32 NumIndices = 0;
+		for (FVectorSplineBuildData* Spline : Splines)
+		{
+			FVectorSplineMeshCache& MeshCache = *Spline->MeshCache;
+			const int32 Slack = GetRangeSlack(Settings, MeshCache.Vertices.Num());
+			MeshCache.SectionFirstVertex = NumVertices;
+			MeshCache.SectionNumVertices = MeshCache.Vertices.Num() + Slack;
+			MeshCache.SectionFirstIndex = NumIndices;
+			MeshCache.SectionNumIndices = MeshCache.Indices.Num() + 3 * Slack;
+			MeshCache.bGeometryChanged = false;
+
+			NumVertices += MeshCache.SectionNumVertices;
+			NumIndices += MeshCache.SectionNumIndices;
+		}
+
+		MeshSection->Vertices.SetNumUninitialized(NumVertices);
+		MeshSection->TextureCoordinates.SetNumUninitialized(NumVertices);
+		MeshSection->VertexColors.SetNumUninitialized(NumVertices);
+		MeshSection->Indices.SetNumUninitialized(NumIndices);
+
+		ParallelFor(Splines.Num(), [&](int32 SplineIdx)
+		{
+			CopySplineGeometryToSection(*Splines[SplineIdx]->MeshCache, MeshSection);
+		});
+
+		SectionLayout.Reset(Splines.Num());
+		for (const FVectorSplineBuildData* Spline : Splines)
+		{
+			MeshSection->SectionLocalBox += Spline->MeshCache->LocalBox;
+			SectionLayout.Add(Spline->SplineComponent);
+		}
+
+		if (NumVertices != 0)
+		{
+			MeshSection->Tangents.Add(FVector::ForwardVector);
+			MeshSection->Normals.Add(FVector::UpVector);
+
+			if (MeshSection->TextureCoordinates.Num() == 0)
+				MeshSection->TextureCoordinates.Add(FVector2D(1.f, 1.f));
+
+		}
+	}
+
+	static void ApplyDefaultMaterials(UVectorMeshComponent* VectorMeshComp)
+	{
+		for (int32 SectionIdx = 0; SectionIdx < VectorMeshComp->GetNumSections(); SectionIdx++)
+		{
+			if (VectorMeshComp->GetMaterial(SectionIdx) == nullptr)
+			{
+				VectorMeshComp->SetMaterial(SectionIdx, FVectorShapeRuntimeHelpers::GetVectorMeshDefaultMaterial());
+			}
+		}
+	}
+
+	/** Cooked actors only keep their splines when they rebuild at runtime, without them a build would clear the cooked mesh. */
+	static bool CanBuildMesh(const AVectorShapeActor* VectorShapeActor)
+	{
+#if !WITH_EDITORONLY_DATA
+		if (!VectorShapeActor->bRebuildAtRuntime)
+		{
+			UE_LOG(LogVectorShape, Warning, TEXT("%s : the vector shape mesh can only be rebuilt at runtime if the actor is set to rebuild at runtime, its splines were not cooked."), *VectorShapeActor->GetName());
+			return false;
+		}
+#endif
+		return true;
+	}
+
+	/** Stores the report on the actor. Failures and undrawn holes are only logged by full quality builds, previews would log them every drag tick. */
+	static void SetBuildReport(AVectorShapeActor* VectorShapeActor, FVectorShapeMeshBuildReport&& Report)
+	{
+		if (!Report.bPreview)
+		{
+			for (const FName& HoleName : Report.UnenclosedHoles)
+			{
+				UE_LOG(LogVectorShape, Warning, TEXT("%s : hole spline %s is not strictly inside any polygon spline and will not be drawn."), *VectorShapeActor->GetName(), *HoleName.ToString());
+			}
+
+			for (const FVectorShapeMeshBuildReport::FTriangulationFailure& Failure : Report.TriangulationFailures)
+			{
+				UE_LOG(LogVectorShape, Warning, TEXT("%s : polygon spline %s could not be triangulated as is, result %s after %.2f ms."),
+					*VectorShapeActor->GetName(), *Failure.SplineName.ToString(), *UEnum::GetValueAsString(Failure.Result), Failure.TriangulationTime * 1000.0);
+			}
+		}
+
+		VectorShapeActor->LastMeshBuildReport = MoveTemp(Report);
+	}
+
+	/**
+	 * Triangulates a contour and its holes, retrying on the cleaned outline, then on its pieces split at self-intersections, then on its convex hull.
+	 * The loops the indices refer to are appended to OutLoops, indices start after the vertices of the loops already there.
+	 */
+	static EVectorTriangulationResult TriangulateWithFallbacks(const TArray<FVector2D>& Contour, const TArray<TArray<FVector2D>>& Holes, const TArray<FPolygonEdgeCrossing>& ContourCrossings, const FVectorShapeMeshBuildSettings& Settings, TArray<uint32>& OutIndices, TArray<TArray<FVector2D>>& OutLoops)
+	{
+		const int32 FirstIndex = OutIndices.Num();
+		const int32 FirstLoop = OutLoops.Num();
+
+		int32 StartVertex = 0;
+		for (const TArray<FVector2D>& Loop : OutLoops)
+		{
+			StartVertex += Loop.Num();
+		}
+
+		auto DiscardOutput = [&]()
+		{
+			OutIndices.SetNum(FirstIndex, false);
+			OutLoops.SetNum(FirstLoop, false);
+		};
+
+		// Outlines crossing themselves triangulate into overlapping triangles, they go straight to the split
+		const bool bCrossesItself = ContourCrossings.Num() > 0;
+
+		if (!bCrossesItself && FPolygonTools::TriangulatePolygonWithHoles(Contour, Holes, OutIndices, StartVertex, Settings.TriangulationMethod))
+		{
+			OutLoops.Add(Contour);
+			OutLoops.Append(Holes);
+			return EVectorTriangulationResult::Triangulated;
+		}
+		DiscardOutput();
+
+		TArray<FVector2D> CleanContour = Contour;
+		FPolygonTools::CleanPolygon(CleanContour);
+
+		TArray<TArray<FVector2D>> CleanHoles = Holes;
+		for (TArray<FVector2D>& CleanHole : CleanHoles)
+		{
+			FPolygonTools::CleanPolygon(CleanHole);
+		}
+		CleanHoles.RemoveAll([](const TArray<FVector2D>& CleanHole) { return CleanHole.Num() < 3; });
+
+		if (!bCrossesItself && FPolygonTools::TriangulatePolygonWithHoles(CleanContour, CleanHoles, OutIndices, StartVertex, Settings.TriangulationMethod))
+		{
+			OutLoops.Add(MoveTemp(CleanContour));
+			OutLoops.Append(MoveTemp(CleanHoles));
+			return EVectorTriangulationResult::Cleaned;
+		}
+		DiscardOutput();
+
+		// Cleaning only removes points, the contour crossings still apply when none was removed
+		TArray<FPolygonEdgeCrossing> CleanCrossings;
+		if (CleanContour.Num() == Contour.Num())
+		{
+			CleanCrossings = ContourCrossings;
+		}
+		else
+		{
+			FPolygonTools::FindSelfIntersections(CleanContour, CleanCrossings);
+		}
+
+		TArray<FVectorPolygon> Pieces;
+		FPolygonTools::SplitSelfIntersections(CleanContour, CleanCrossings, Settings.FillRule, Pieces);
+
+		// Each simple piece also gets the holes starting inside it
+		bool bPiecesTriangulated = Pieces.Num() > 0;
+		int32 PieceStartVertex = StartVertex;
+		for (FVectorPolygon& Piece : Pieces)
+		{
+			for (const TArray<FVector2D>& CleanHole : CleanHoles)
+			{
+				if (FPolygonTools::IsPointInsidePolygon(Piece.Contour, CleanHole[0]))
+				{
+					Piece.Holes.Add(CleanHole);
+				}
+			}
+
+			if (!FPolygonTools::TriangulatePolygonWithHoles(Piece.Contour, Piece.Holes, OutIndices, PieceStartVertex, Settings.TriangulationMethod))
+			{
+				bPiecesTriangulated = false;
+				break;
+			}
+
+			PieceStartVertex += Piece.Contour.Num();
+			OutLoops.Add(MoveTemp(Piece.Contour));
+			for (TArray<FVector2D>& PieceHole : Piece.Holes)
+			{
+				PieceStartVertex += PieceHole.Num();
+				OutLoops.Add(MoveTemp(PieceHole));
+			}
+		}
+
+		if (bPiecesTriangulated)
+		{
+			return EVectorTriangulationResult::SplitSelfIntersections;
+		}
+		DiscardOutput();
+
+		TArray<FVector2D> Hull;
+		FPolygonTools::ConvexHull(CleanContour, Hull);
+		// The hull is counter clockwise, fanned as is its triangles would face the other way from every other path
+		Algo::Reverse(Hull);
+		if (FPolygonTools::TriangulateSimplePolygon(OutIndices, Hull.Num(), StartVertex))
+		{
+			OutLoops.Add(MoveTemp(Hull));
+			return EVectorTriangulationResult::ConvexHull;
+		}
+		DiscardOutput();
+
+		return EVectorTriangulationResult::Failed;
+	}
+
+	/** Emits the vertices of the loops a polygon was triangulated from, in the order the indices refer to them. */
+	static void AddLoopsVertices(const FVectorSplineBuildData& Spline, const FVectorShapeMeshBuildSettings& Settings, const TArray<TArray<FVector2D>>& Loops)
+	{
+		FVectorSplineMeshCache& MeshCache = *Spline.MeshCache;
+
+		int32 NumVertices = 0;
+		for (const TArray<FVector2D>& Loop : Loops)
+		{
+			NumVertices += Loop.Num();
+		}
+
+		MeshCache.Vertices.Reserve(NumVertices);
+		MeshCache.VertexColors.Reserve(NumVertices);
+		MeshCache.TextureCoordinates.Reserve(NumVertices);
+
+		for (const TArray<FVector2D>& Loop : Loops)
+		{
+			for (const FVector2D& Vertex2D : Loop)
+			{
+				const FVector Vertex3D = FVector(Vertex2D.X, Vertex2D.Y, Spline.OffsetZ);
+				MeshCache.Vertices.Add(Vertex3D);
+				MeshCache.VertexColors.Add(Spline.SplineColor);
+				MeshCache.TextureCoordinates.Add(Vertex2D / Settings.WorldSize);
+				MeshCache.LocalBox += Vertex3D;
+			}
+		}
+	}
+
+	/** Boolean operations and occluders applied to a polygon layer, and the regions they leave. */
+	struct FSplineBooleans
+	{
+		/** Union and subtract splines applied to the layer, in draw order. */
+		TArray<TPair<EVectorBooleanOperation, FVectorSplineBuildData*>> Operations;
+
+		/** Layers drawn over this one and hiding parts of it. */
+		TArray<int32> Occluders;
+
+		/** Bounds of the layer, grown by the splines merged into it. */
+		FBox2D Bounds;
+
+		/** Layer once its operations are applied, occluders aside. Only computed when needed by a rebuilt layer. */
+		TArray<FVectorPolygon> Regions;
+		bool bNeedsRegions;
+
+		FSplineBooleans()
+			: Bounds(ForceInit)
+			, bNeedsRegions(false)
+		{
+		}
+
+		FORCEINLINE bool HasBooleans() const { return Operations.Num() > 0 || Occluders.Num() > 0; }
+	};
+
+	static bool BoundsOverlap(const FBox2D& BoxA, const FBox2D& BoxB)
+	{
+		return BoxA.bIsValid && BoxB.bIsValid && BoxA.Intersect(BoxB);
+	}
+
+	/**
+	 * Applies union and subtract splines to the polygon layers drawn below them and removes them from the drawn splines.
+	 * A union spline merges into the closest overlapping layer below it, and is drawn as a layer itself if there is none. A subtract spline cuts every overlapping layer below it.
+	 * OutBooleans follows the order of the splines left.
+	 */
+	static void ResolveBooleans(TArray<FVectorSplineBuildData*>& Splines, const FVectorShapeMeshBuildSettings& Settings, TArray<FSplineBooleans>& OutBooleans)
+	{
+		TArray<FVectorSplineBuildData*> Layers;
+		Layers.Reserve(Splines.Num());
+		OutBooleans.Reset(Splines.Num());
+
+		for (FVectorSplineBuildData* Spline : Splines)
+		{
+			const FBox2D& Bounds = Spline->MeshCache->ContourBounds;
+			if (Spline->SplineType == EVectorSplineType::Polygon && Spline->BooleanMode != EVectorSplineBooleanMode::Layer)
+			{
+				bool bIsMerged = false;
+				for (int32 LayerIdx = Layers.Num() - 1; LayerIdx >= 0 && !bIsMerged; LayerIdx--)
+				{
+					FSplineBooleans& LayerBooleans = OutBooleans[LayerIdx];
+					if (Layers[LayerIdx]->SplineType != EVectorSplineType::Polygon || !BoundsOverlap(LayerBooleans.Bounds, Bounds))
+					{
+						continue;
+					}
+
+					if (Spline->BooleanMode == EVectorSplineBooleanMode::Union)
+					{
+						LayerBooleans.Operations.Emplace(EVectorBooleanOperation::Union, Spline);
+						LayerBooleans.Bounds += Bounds;
+						bIsMerged = true;
+					}
+					else
+					{
+						LayerBooleans.Operations.Emplace(EVectorBooleanOperation::Difference, Spline);
+					}
+				}
+
+				if (bIsMerged || Spline->BooleanMode == EVectorSplineBooleanMode::Subtract)
+				{
+					// Not drawn, a later change of mode rebuilds it from scratch
+					Spline->MeshCache->ResetGeometry();
+					Spline->MeshCache->bHasGeometry = false;
+					continue;
+				}
+			}
+
+			Layers.Add(Spline);
+			OutBooleans.AddDefaulted_GetRef().Bounds = Bounds;
+		}
+
+		// Opaque polygons hide the polygons of their section drawn before them
+		if (Settings.bRemoveHiddenGeometry)
+		{
+			for (int32 LayerIdx = 0; LayerIdx < Layers.Num(); LayerIdx++)
+			{
+				const FVectorSplineBuildData* Layer = Layers[LayerIdx];
+				if (Layer->SplineType != EVectorSplineType::Polygon)
+				{
+					continue;
+				}
+
+				for (int32 AboveIdx = LayerIdx + 1; AboveIdx < Layers.Num(); AboveIdx++)
+				{
+					const FVectorSplineBuildData* AboveLayer = Layers[AboveIdx];
+					if (AboveLayer->SplineType == EVectorSplineType::Polygon
+						&& AboveLayer->MaterialSlot == Layer->MaterialSlot
+						&& AboveLayer->SplineColor.A == 255
+						&& BoundsOverlap(OutBooleans[AboveIdx].Bounds, OutBooleans[LayerIdx].Bounds))
+					{
+						OutBooleans[LayerIdx].Occluders.Add(AboveIdx);
+					}
+				}
+			}
+		}
+
+		Splines = MoveTemp(Layers);
+	}
+
+	/** Hash of the contour of a polygon spline and of its hole splines. */
+	static uint32 GetRegionsHash(FVectorSplineBuildData* Spline, const TMap<FVectorSplineBuildData*, TArray<FVectorSplineBuildData*>>& SplineHoles)
+	{
+		uint32 Hash = Spline->MeshCache->ContourHash;
+		if (const TArray<FVectorSplineBuildData*>* HoleSplines = SplineHoles.Find(Spline))
+		{
+			for (const FVectorSplineBuildData* HoleSpline : *HoleSplines)
+			{
+				Hash = HashCombine(Hash, HoleSpline->MeshCache->ContourHash);
+			}
+		}
+		return Hash;
+	}
+
+	/** Hash of the splines the boolean operations and occluders of a layer are computed from. */
+	static uint32 GetBooleansHash(const TArray<FVectorSplineBuildData*>& Layers, const TArray<FSplineBooleans>& Booleans, int32 LayerIdx, const TMap<FVectorSplineBuildData*, TArray<FVectorSplineBuildData*>>& SplineHoles)
+	{
+		auto GetLayerHash = [&](int32 Idx)
+		{
+			uint32 Hash = GetRegionsHash(Layers[Idx], SplineHoles);
+			for (const TPair<EVectorBooleanOperation, FVectorSplineBuildData*>& Operation : Booleans[Idx].Operations)
+			{
+				Hash = HashCombine(Hash, GetTypeHash(Operation.Key));
+				Hash = HashCombine(Hash, GetRegionsHash(Operation.Value, SplineHoles));
+			}
+			return Hash;
+		};
+
+		uint32 Hash = GetLayerHash(LayerIdx);
+		for (int32 OccluderIdx : Booleans[LayerIdx].Occluders)
+		{
+			Hash = HashCombine(Hash, GetLayerHash(OccluderIdx));
+		}
+		return Hash;
+	}
+
+	/** Area a polygon spline fills : its pieces when its outline crosses itself, its contour otherwise, with its hole splines cut out. */
+	static void GetSplineRegions(const FVectorSplineBuildData& Spline, const TArray<FVectorSplineBuildData*>& HoleSplines, const FVectorShapeMeshBuildSettings& Settings, TArray<FVectorPolygon>& OutRegions)
+	{
+		const FVectorSplineMeshCache& MeshCache = *Spline.MeshCache;
+
+		OutRegions.Reset();
+		if (MeshCache.Contour.Num() < 3)
+		{
+			return;
+		}
+
+		if (MeshCache.ContourCrossings.Num() > 0)
+		{
+			FPolygonTools::SplitSelfIntersections(MeshCache.Contour, MeshCache.ContourCrossings, Settings.FillRule, OutRegions);
+		}
+		else
+		{
+			OutRegions.AddDefaulted_GetRef().Contour = MeshCache.Contour;
+		}
+
+		for (const FVectorSplineBuildData* HoleSpline : HoleSplines)
+		{
+			const TArray<FVector2D>& HoleContour = HoleSpline->MeshCache->Contour;
+			for (FVectorPolygon& Region : OutRegions)
+			{
+				if (FPolygonTools::IsPointInsidePolygon(Region.Contour, HoleContour[0]))
+				{
+					Region.Holes.Add(HoleContour);
+					break;
+				}
+			}
+		}
+	}
+}
+
+
+void FVectorShapeMeshBuilder::FlattenSpline(const FSplineCurves& SplineCurves, const FVectorShapeMeshBuildSettings& Settings, TArray<FVector2D>& OutContour)
+{
+	FPolygonTools::SimplifySplinePolygon(SplineCurves, Settings, OutContour);
+	FPolygonTools::CleanPolygon(OutContour);
+}
+
+void FVectorShapeMeshBuilder::BuildLineGeometry(const FVectorSplineBuildData& Spline, const FVectorShapeMeshBuildSettings& Settings)
+{
+	FVectorSplineMeshCache& MeshCache = *Spline.MeshCache;
+	const FSplineCurves& SplineCurves = *Spline.SplineCurves;
+	const TArray<FVector2D>& Vertices2D = MeshCache.Contour;
+	const FColor& VertexColor = Spline.SplineColor;
+	const float& OffsetZ = Spline.OffsetZ;
+	const float& LineWidth = Settings.LineDefaultWidth;
+	const FVector2D& WorldSize = Settings.WorldSize;
+
+	const int32 NumVerts = Vertices2D.Num();
+	MeshCache.Vertices.Reserve(NumVerts * 2);
+	MeshCache.VertexColors.Reserve(NumVerts * 2);
+	MeshCache.TextureCoordinates.Reserve(NumVerts * 2);
+	MeshCache.Indices.Reserve(FMath::Max(NumVerts - 1, 0) * 6);
+
+	int32 RunningIndex = 0;
+
+	FVector2D Norm(ForceInitToZero);
+
+	for (int32 VertIdx = 0; VertIdx < NumVerts; VertIdx++)
+	{
+		const FVector2D& P1 = Vertices2D[VertIdx];
+		const FVector2D& P2 = (VertIdx == NumVerts - 1) ? Vertices2D[VertIdx - 1] : Vertices2D[VertIdx + 1];
+
+		const FVector2D Dir = (VertIdx == NumVerts - 1) ? (P1 - P2) : (P2 - P1);
+
+
+		 if (VertIdx > 0 && VertIdx < NumVerts - 1)
+		 {
+			 const FVector2D& P0 = Vertices2D[VertIdx - 1];
+			 const FVector2D Dir2 = (P1 - P0);
+			 Norm = ((FVector2D(Dir.Y, -Dir.X).GetSafeNormal() + FVector2D(Dir2.Y, -Dir2.X).GetSafeNormal()) / 2.0f).GetSafeNormal();
+		 }
+		 else
+		 {
+			  Norm = FVector2D(Dir.Y, -Dir.X).GetSafeNormal();
+		 }
+
+		// Splines have an identity relative transform, the contour is already in spline space
+		float DistanceSq;
+		const float InputKey = SplineCurves.Position.InaccurateFindNearest(FVector(P1, 0), DistanceSq);
+		const float S0 = SplineCurves.Scale.Eval(InputKey, FVector(1.0f)).Y;
+
+		const FVector V0 = FVector(P1 + Norm * LineWidth * S0, OffsetZ);
+		const FVector V1 = FVector(P1 - Norm * LineWidth * S0, OffsetZ);
+
+		MeshCache.Vertices.Add(V0);
+		MeshCache.Vertices.Add(V1);
+
+		MeshCache.VertexColors.Add(VertexColor);
+		MeshCache.VertexColors.Add(VertexColor);
+
+		MeshCache.TextureCoordinates.Add(FVector2D(V0.X, V0.Y) / WorldSize);
+		MeshCache.TextureCoordinates.Add(FVector2D(V1.X, V1.Y) / WorldSize);
+
+		MeshCache.LocalBox += V0;
+		MeshCache.LocalBox += V1;
+
+		RunningIndex += 2;
+
+		if (VertIdx < NumVerts - 1)
+		{
+			const int32 T0 = RunningIndex - 2;
+			const int32 T1 = RunningIndex - 1;
+			const int32 T2 = T0 + 2;
+			const int32 T3 = T0 + 3;
+
+			MeshCache.Indices.Add(T0);
+			MeshCache.Indices.Add(T1);
+			MeshCache.Indices.Add(T3);
+
+			MeshCache.Indices.Add(T3);
+			MeshCache.Indices.Add(T2);
+			MeshCache.Indices.Add(T0);
+		}
+	}
+}
+
+bool FVectorShapeMeshBuilder::BuildPolygonGeometry(const FVectorSplineBuildData& Spline, const TArray<const TArray<FVector2D>*>& HoleContours, const FVectorShapeMeshBuildSettings& Settings)
+{
+	FVectorSplineMeshCache& MeshCache = *Spline.MeshCache;
+
+	const double StartTime = FPlatformTime::Seconds();
+
+	TArray<TArray<FVector2D>> Holes;
+	Holes.Reserve(HoleContours.Num());
+	int32 NumVertices = MeshCache.Contour.Num();
+	for (const TArray<FVector2D>* HoleContour : HoleContours)
+	{
+		Holes.Add(*HoleContour);
+		NumVertices += HoleContour->Num();
+	}
+
+	MeshCache.Indices.Reserve(FMath::Max(NumVertices - 2 + 2 * Holes.Num(), 0) * 3);
+
+	TArray<TArray<FVector2D>> Loops;
+	const EVectorTriangulationResult Result = VectorMeshBuild::TriangulateWithFallbacks(MeshCache.Contour, Holes, MeshCache.ContourCrossings, Settings, MeshCache.Indices, Loops);
+	VectorMeshBuild::AddLoopsVertices(Spline, Settings, Loops);
+
+	MeshCache.TriangulationResult = Result;
+	MeshCache.TriangulationTime = FPlatformTime::Seconds() - StartTime;
+
+	return Result != EVectorTriangulationResult::Failed;
+}
+
+bool FVectorShapeMeshBuilder::BuildRegionsGeometry(const FVectorSplineBuildData& Spline, const TArray<FVectorPolygon>& Regions, const FVectorShapeMeshBuildSettings& Settings)
+{
+	FVectorSplineMeshCache& MeshCache = *Spline.MeshCache;
+
+	const double StartTime = FPlatformTime::Seconds();
+
+	// Boolean results never cross themselves
+	const TArray<FPolygonEdgeCrossing> NoCrossings;
+
+	TArray<TArray<FVector2D>> Loops;
+	EVectorTriangulationResult Result = EVectorTriangulationResult::Triangulated;
+	for (const FVectorPolygon& Region : Regions)
+	{
+		Result = FMath::Max(Result, VectorMeshBuild::TriangulateWithFallbacks(Region.Contour, Region.Holes, NoCrossings, Settings, MeshCache.Indices, Loops));
+	}
+	VectorMeshBuild::AddLoopsVertices(Spline, Settings, Loops);
+
+	MeshCache.TriangulationResult = Result;
+	MeshCache.TriangulationTime = FPlatformTime::Seconds() - StartTime;
+
+	return Result != EVectorTriangulationResult::Failed;
+}
+
+void FVectorShapeMeshBuilder::BuildSplinesGeometry(TArray<FVectorSplineBuildData>& SplinesData, const FVectorShapeMeshBuildSettings& Settings, TArray<TArray<FVectorSplineBuildData*>>& OutSectionSplines, FVectorShapeMeshBuildReport& OutReport, TFunctionRef<bool()> IsCancelled)
+{
+	OutSectionSplines.Reset();
+
+	const double StartTime = FPlatformTime::Seconds();
+	OutReport = FVectorShapeMeshBuildReport();
+	OutReport.bPreview = Settings.bPreview;
+
+	TArray<FVectorSplineBuildData*> Splines;
+	Splines.Reserve(SplinesData.Num());
+	for (FVectorSplineBuildData& SplineData : SplinesData)
+	{
+		Splines.Add(&SplineData);
+	}
+
+	// Flatten the splines whose curve or build settings changed since the last build
+	{
+		SCOPE_CYCLE_COUNTER(STAT_VectorMesh_FlattenSplines);
+
+		ParallelFor(Splines.Num(), [&](int32 SplineIdx)
+		{
+			const FVectorSplineBuildData& Spline = *Splines[SplineIdx];
+			FVectorSplineMeshCache& MeshCache = *Spline.MeshCache;
+
+			const uint32 ContourHash = VectorMeshBuild::GetContourHash(Settings, Spline);
+			if (!MeshCache.bHasContour || MeshCache.ContourHash != ContourHash)
+			{
+				FlattenSpline(*Spline.SplineCurves, Settings, MeshCache.Contour);
+				if (Spline.SplineType == EVectorSplineType::Polygon)
+				{
+					FPolygonTools::FindSelfIntersections(MeshCache.Contour, MeshCache.ContourCrossings);
+				}
+				else
+				{
+					MeshCache.ContourCrossings.Reset();
+				}
+				MeshCache.ContourBounds = FBox2D(MeshCache.Contour);
+				MeshCache.ContourArea = FMath::Abs(FPolygonTools::Area(MeshCache.Contour));
+				MeshCache.ContourHash = ContourHash;
+				MeshCache.bHasContour = true;
+			}
+		});
+	}
+
+	if (IsCancelled())
+	{
+		return;
+	}
+
+	// Cut hole splines out of the smallest polygon enclosing them
+	TMap<FVectorSplineBuildData*, TArray<FVectorSplineBuildData*>> SplineHoles;
+
+	{
+		for (FVectorSplineBuildData* HoleSpline : Splines)
+		{
+			if (!HoleSpline->IsHolePolygon() || HoleSpline->MeshCache->Contour.Num() < 3)
+			{
+				continue;
+			}
+
+			const FVectorSplineMeshCache& HoleMeshCache = *HoleSpline->MeshCache;
+
+			// Holes crossing or touching their polygon cannot be bridged into it
+			FVectorSplineBuildData* EnclosingSpline = nullptr;
+			float EnclosingArea = MAX_flt;
+			for (FVectorSplineBuildData* Spline : Splines)
+			{
+				const FVectorSplineMeshCache& MeshCache = *Spline->MeshCache;
+				if (Spline->SplineType == EVectorSplineType::Polygon && !Spline->IsHolePolygon() && MeshCache.Contour.Num() >= 3
+					&& MeshCache.ContourArea < EnclosingArea
+					&& MeshCache.ContourBounds.IsInside(HoleMeshCache.ContourBounds)
+					&& FPolygonTools::IsPolygonInsidePolygon(HoleMeshCache.Contour, MeshCache.Contour))
+				{
+					EnclosingArea = MeshCache.ContourArea;
+					EnclosingSpline = Spline;
+				}
+			}
+
+			if (EnclosingSpline != nullptr)
+			{
+				SplineHoles.FindOrAdd(EnclosingSpline).Add(HoleSpline);
+			}
+			else
+			{
+				OutReport.UnenclosedHoles.Add(HoleSpline->SplineName);
+			}
+		}
+
+		Splines.RemoveAll([](const FVectorSplineBuildData* Spline) { return Spline->IsHolePolygon(); });
+	}
+
+	// Order in which polygons will be drawn, keeping the component order for equal depths
+	Algo::StableSortBy(Splines, [](const FVectorSplineBuildData* Spline) { return Spline->OffsetZ; });
+
+	// Union and subtract splines become operations of the layers below them
+	TArray<VectorMeshBuild::FSplineBooleans> Booleans;
+	VectorMeshBuild::ResolveBooleans(Splines, Settings, Booleans);
+
+	// Regenerate the geometry of the splines that changed
+	{
+		SCOPE_CYCLE_COUNTER(STAT_VectorMesh_BuildGeometry);
+
+		const TArray<FVectorSplineBuildData*> NoHoles;
+		auto GetHoleSplines = [&](FVectorSplineBuildData* Spline) -> const TArray<FVectorSplineBuildData*>&
+		{
+			const TArray<FVectorSplineBuildData*>* HoleSplines = SplineHoles.Find(Spline);
+			return HoleSplines ? *HoleSplines : NoHoles;
+		};
+
+		const int32 NumSplines = Splines.Num();
+		TArray<uint32> GeometryHashes;
+		GeometryHashes.SetNumUninitialized(NumSplines);
+
+		ParallelFor(NumSplines, [&](int32 SplineIdx)
+		{
+			FVectorSplineBuildData& Spline = *Splines[SplineIdx];
+			uint32 GeometryHash = VectorMeshBuild::GetGeometryHash(Settings, Spline, GetHoleSplines(&Spline));
+			if (Booleans[SplineIdx].HasBooleans())
+			{
+				GeometryHash = HashCombine(GeometryHash, VectorMeshBuild::GetBooleansHash(Splines, Booleans, SplineIdx, SplineHoles));
+			}
+			GeometryHashes[SplineIdx] = GeometryHash;
+		});
+
+		// Layers rebuilt with booleans need their own regions, and the regions of the layers hiding them
+		TArray<int32> RebuiltSplines;
+		for (int32 SplineIdx = 0; SplineIdx < NumSplines; SplineIdx++)
+		{
+			const FVectorSplineMeshCache& MeshCache = *Splines[SplineIdx]->MeshCache;
+			if (MeshCache.bHasGeometry && MeshCache.GeometryHash == GeometryHashes[SplineIdx])
+			{
+				continue;
+			}
+
+			RebuiltSplines.Add(SplineIdx);
+			if (Booleans[SplineIdx].HasBooleans())
+			{
+				Booleans[SplineIdx].bNeedsRegions = true;
+				for (int32 OccluderIdx : Booleans[SplineIdx].Occluders)
+				{
+					Booleans[OccluderIdx].bNeedsRegions = true;
+				}
+			}
+		}
+
+		ParallelFor(NumSplines, [&](int32 SplineIdx)
+		{
+			VectorMeshBuild::FSplineBooleans& SplineBooleans = Booleans[SplineIdx];
+			if (!SplineBooleans.bNeedsRegions || IsCancelled())
+			{
+				return;
+			}
+
+			FVectorSplineBuildData* Spline = Splines[SplineIdx];
+			VectorMeshBuild::GetSplineRegions(*Spline, GetHoleSplines(Spline), Settings, SplineBooleans.Regions);
+
+			TArray<FVectorPolygon> OperandRegions;
+			TArray<FVectorPolygon> ResultRegions;
+			for (const TPair<EVectorBooleanOperation, FVectorSplineBuildData*>& Operation : SplineBooleans.Operations)
+			{
+				VectorMeshBuild::GetSplineRegions(*Operation.Value, GetHoleSplines(Operation.Value), Settings, OperandRegions);
+				FPolygonTools::ClipPolygons(SplineBooleans.Regions, OperandRegions, Operation.Key, ResultRegions);
+				Swap(SplineBooleans.Regions, ResultRegions);
+			}
+		});
+
+		ParallelFor(RebuiltSplines.Num(), [&](int32 RebuiltIdx)
+		{
+			if (IsCancelled())
+			{
+				return;
+			}
+
+			const int32 SplineIdx = RebuiltSplines[RebuiltIdx];
+			FVectorSplineBuildData& Spline = *Splines[SplineIdx];
+			const VectorMeshBuild::FSplineBooleans& SplineBooleans = Booleans[SplineIdx];
+
+			FVectorSplineMeshCache& MeshCache = *Spline.MeshCache;
+			MeshCache.ResetGeometry();
+			if (Spline.SplineType == EVectorSplineType::Line)
+			{
+				BuildLineGeometry(Spline, Settings);
+			}
+			else if (SplineBooleans.HasBooleans())
+			{
+				// Regions are shared with the layers below, hidden parts are cut out of a copy
+				TArray<FVectorPolygon> VisibleRegions = SplineBooleans.Regions;
+				TArray<FVectorPolygon> ResultRegions;
+				for (int32 OccluderIdx : SplineBooleans.Occluders)
+				{
+					FPolygonTools::ClipPolygons(VisibleRegions, Booleans[OccluderIdx].Regions, EVectorBooleanOperation::Difference, ResultRegions);
+					Swap(VisibleRegions, ResultRegions);
+				}
+
+				BuildRegionsGeometry(Spline, VisibleRegions, Settings);
+			}
+			else
+			{
+				const TArray<FVectorSplineBuildData*>& Holes = GetHoleSplines(&Spline);
+
+				TArray<const TArray<FVector2D>*> HoleContours;
+				HoleContours.Reserve(Holes.Num());
+				for (const FVectorSplineBuildData* HoleSpline : Holes)
+				{
+					HoleContours.Add(&HoleSpline->MeshCache->Contour);
+				}
+
+				BuildPolygonGeometry(Spline, HoleContours, Settings);
+			}
+
+			MeshCache.GeometryHash = GeometryHashes[SplineIdx];
+			MeshCache.bHasGeometry = true;
+			MeshCache.bGeometryChanged = true;
+		});
+	}
+
+	// Unchanged splines report the fallback their cached geometry was built with
+	for (const FVectorSplineBuildData* Spline : Splines)
+	{
+		const FVectorSplineMeshCache& MeshCache = *Spline->MeshCache;
+		if (Spline->SplineType == EVectorSplineType::Polygon && MeshCache.bHasGeometry && MeshCache.TriangulationResult != EVectorTriangulationResult::Triangulated)
+		{
+			OutReport.TriangulationFailures.Add({ Spline->SplineName, MeshCache.TriangulationResult, MeshCache.TriangulationTime });
+		}
+	}
+	OutReport.BuildTime = FPlatformTime::Seconds() - StartTime;
+
+	// One section per material slot, splines keep their depth order inside each section
+	for (FVectorSplineBuildData* Spline : Splines)
+	{
+		if (OutSectionSplines.Num() <= Spline->MaterialSlot)
+		{
+			OutSectionSplines.SetNum(Spline->MaterialSlot + 1);
+		}
+		OutSectionSplines[Spline->MaterialSlot].Add(Spline);
+	}
+
+	OutSectionSplines.SetNum(FMath::Max(OutSectionSplines.Num(), 1));
+}
+
+
+FVectorShapeMeshBuildSettings FVectorShapeMeshBuilder::GetBuildSettings(const AVectorShapeActor* VectorShapeActor, bool bPreview)
+{
+	FVectorShapeMeshBuildSettings Settings = VectorShapeActor->GetMeshBuildSettings();
+	if (bPreview)
+	{
+		Settings.bPreview = true;
+		Settings.bUseFixedStepsPerSegment = true;
+		Settings.StepsPerSegment = FMath::Clamp(CVarVectorShapePreviewStepsPerSegment.GetValueOnGameThread(), 1, Settings.StepsPerSegment);
+	}
+	return Settings;
+}
+
+void FVectorShapeMeshBuilder::RequestPreviewBuild(AVectorShapeActor* VectorShapeActor)
+{
+	check(IsInGameThread());
+
+	bool bAlreadyPending = false;
+	VectorMeshBuild::PendingPreviewBuilds.Add(VectorShapeActor, &bAlreadyPending);
+	if (bAlreadyPending)
+	{
+		INC_DWORD_STAT(STAT_VectorMesh_CoalescedPreviewBuilds);
+	}
+
+	if (!VectorMeshBuild::PreviewBuildsTickerHandle.IsValid())
+	{
+		VectorMeshBuild::PreviewBuildsTickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateStatic(&FVectorShapeMeshBuilder::TickPreviewBuilds));
+	}
+}
+
+bool FVectorShapeMeshBuilder::TickPreviewBuilds(float DeltaTime)
+{
+	const TSet<TWeakObjectPtr<AVectorShapeActor>> PreviewBuilds = MoveTemp(VectorMeshBuild::PendingPreviewBuilds);
+	VectorMeshBuild::PendingPreviewBuilds.Reset();
+
+	// Unregistered until the next request
+	VectorMeshBuild::PreviewBuildsTickerHandle.Reset();
+
+	for (const TWeakObjectPtr<AVectorShapeActor>& PreviewBuild : PreviewBuilds)
+	{
+		if (AVectorShapeActor* VectorShapeActor = PreviewBuild.Get())
+		{
+			if (VectorShapeActor->bBuildAsync)
+			{
+				BuildVectorShapeMeshAsync(VectorShapeActor, true);
+			}
+			else
+			{
+				BuildVectorShapeMesh(VectorShapeActor, true);
+			}
+		}
+	}
+
+	return false;
+}
+
+void FVectorShapeMeshBuilder::BuildVectorShapeMesh(AVectorShapeActor* VectorShapeActor, bool bPreview)
+{
+	if (!IsValid(VectorShapeActor) || VectorShapeActor->IsUnreachable() || !VectorMeshBuild::CanBuildMesh(VectorShapeActor))
+	{
+		return;
+	}
+
+	// This build supersedes any background build in flight
+	CancelAsyncBuild(VectorShapeActor);
+
+	if (!bPreview)
+	{
+		VectorMeshBuild::PendingPreviewBuilds.Remove(VectorShapeActor);
+	}
+
+	UVectorMeshComponent* VectorMeshComp = VectorShapeActor->GetMeshComponent();
+
+	if (!VectorShapeActor->bDrawMesh)
+	{
+		VectorMeshComp->ClearMeshSections(false);
+		VectorShapeActor->MeshSplineLayout.Reset();
+		return;
+	}
+
+	const FVectorShapeMeshBuildSettings Settings = GetBuildSettings(VectorShapeActor, bPreview);
+
+	TArray<FVectorSplineBuildData> Splines;
+
+	{
+		TArray<UVectorSplineComponent*> SplineComps;
+		VectorMeshBuild::GatherSplines(VectorShapeActor, SplineComps);
+
+		Splines.Reserve(SplineComps.Num());
+		for (UVectorSplineComponent* SplineComp : SplineComps)
+		{
+			Splines.Emplace(SplineComp);
+		}
+	}
+
+	TArray<TArray<FVectorSplineBuildData*>> SectionSplines;
+	FVectorShapeMeshBuildReport Report;
+	BuildSplinesGeometry(Splines, Settings, SectionSplines, Report, []() { return false; });
+	VectorMeshBuild::SetBuildReport(VectorShapeActor, MoveTemp(Report));
+
+	const int32 NumSections = SectionSplines.Num();
+
+	// Splice into the existing sections when only some ranges changed, otherwise lay the section out again
+	bool bRecreateRenderState = false;
+	TArray<TArray<FVectorShapeMeshSectionRange>, TInlineAllocator<UVectorSplineComponent::MaxMaterialSlots>> SectionDirtyRanges;
+	SectionDirtyRanges.SetNum(NumSections);
+	{
+		SCOPE_CYCLE_COUNTER(STAT_VectorMesh_AssembleSection);
+
+		TArray<TArray<TWeakObjectPtr<UVectorSplineComponent>>>& MeshSplineLayout = VectorShapeActor->MeshSplineLayout;
+		if (VectorMeshComp->GetNumSections() != NumSections || MeshSplineLayout.Num() != NumSections)
+		{
+			VectorMeshComp->InitMeshSections(NumSections);
+			MeshSplineLayout.Reset(NumSections);
+			MeshSplineLayout.SetNum(NumSections);
+			bRecreateRenderState = true;
+		}
+
+		for (int32 SectionIdx = 0; SectionIdx < NumSections; SectionIdx++)
+		{
+			FVectorShapeMeshSection* MeshSection = VectorMeshComp->GetVectorMeshSection(SectionIdx);
+
+			if (!VectorMeshBuild::SpliceChangedSplines(MeshSplineLayout[SectionIdx], MeshSection, SectionSplines[SectionIdx], SectionDirtyRanges[SectionIdx]))
+			{
+				VectorMeshBuild::RebuildSection(MeshSplineLayout[SectionIdx], MeshSection, SectionSplines[SectionIdx], Settings);
+				bRecreateRenderState = true;
+			}
+		}
+	}
+
+	VectorMeshBuild::ApplyDefaultMaterials(VectorMeshComp);
+
+	// Finalize Mesh, spliced sections keep their size and only their rewritten ranges are uploaded
+	if (bRecreateRenderState)
+	{
+		VectorMeshComp->MarkMeshDirty();
+	}
+	else
+	{
+		for (int32 SectionIdx = 0; SectionIdx < NumSections; SectionIdx++)
+		{
+			VectorMeshComp->MarkMeshSectionRangesDirty(SectionIdx, SectionDirtyRanges[SectionIdx]);
+		}
+	}
+}
+
+void FVectorShapeMeshBuilder::BuildVectorShapeMeshAsync(AVectorShapeActor* VectorShapeActor, bool bPreview)
+{
+	check(IsInGameThread());
+
+	if (!IsValid(VectorShapeActor) || VectorShapeActor->IsUnreachable() || !VectorMeshBuild::CanBuildMesh(VectorShapeActor))
+	{
+		return;
+	}
+
+	if (!bPreview)
+	{
+		VectorMeshBuild::PendingPreviewBuilds.Remove(VectorShapeActor);
+	}
+
+	if (!VectorShapeActor->bDrawMesh)
+	{
+		BuildVectorShapeMesh(VectorShapeActor);
+		return;
+	}
+
+	// Coalesced into a single build started with the latest splines once the build in flight is done, the latest request picks the quality
+	if (VectorShapeActor->AsyncMeshBuild.IsValid())
+	{
+		VectorShapeActor->bAsyncMeshBuildPending = true;
+		VectorShapeActor->bAsyncMeshBuildPendingPreview = bPreview;
+		INC_DWORD_STAT(STAT_VectorMesh_CoalescedAsyncBuilds);
+		return;
+	}
+
+	TSharedRef<FVectorShapeAsyncMeshBuild, ESPMode::ThreadSafe> AsyncBuild = MakeShared<FVectorShapeAsyncMeshBuild, ESPMode::ThreadSafe>();
+
+	{
+		SCOPE_CYCLE_COUNTER(STAT_VectorMesh_SnapshotSplines);
+
+		AsyncBuild->Actor = VectorShapeActor;
+		AsyncBuild->Settings = GetBuildSettings(VectorShapeActor, bPreview);
+
+		TArray<UVectorSplineComponent*> SplineComps;
+		VectorMeshBuild::GatherSplines(VectorShapeActor, SplineComps);
+
+		// Reserved up front, the build data points into these arrays
+		AsyncBuild->SplineCurves.Reserve(SplineComps.Num());
+		AsyncBuild->MeshCaches.Reserve(SplineComps.Num());
+		AsyncBuild->Splines.Reserve(SplineComps.Num());
+		for (UVectorSplineComponent* SplineComp : SplineComps)
+		{
+			FVectorSplineBuildData& Spline = AsyncBuild->Splines.Emplace_GetRef(SplineComp);
+			Spline.SplineCurves = &AsyncBuild->SplineCurves.Add_GetRef(SplineComp->SplineCurves);
+			Spline.MeshCache = &AsyncBuild->MeshCaches.Add_GetRef(SplineComp->MeshCache);
+		}
+	}
+
+	VectorShapeActor->AsyncMeshBuild = AsyncBuild;
+
+	UE::Tasks::Launch(UE_SOURCE_LOCATION, [AsyncBuild]()
+	{
+		FVectorShapeAsyncMeshBuild& Build = AsyncBuild.Get();
+		auto IsCancelled = [&Build]() { return Build.bCancelled.load(std::memory_order_relaxed); };
+
+		TArray<TArray<FVectorSplineBuildData*>> SectionSplines;
+		BuildSplinesGeometry(Build.Splines, Build.Settings, SectionSplines, Build.Report, IsCancelled);
+
+		if (!IsCancelled())
+		{
+			SCOPE_CYCLE_COUNTER(STAT_VectorMesh_AssembleSection);
+
+			Build.MeshSections.SetNum(SectionSplines.Num());
+			Build.MeshSplineLayout.SetNum(SectionSplines.Num());
+			for (int32 SectionIdx = 0; SectionIdx < SectionSplines.Num(); SectionIdx++)
+			{
+				VectorMeshBuild::RebuildSection(Build.MeshSplineLayout[SectionIdx], &Build.MeshSections[SectionIdx], SectionSplines[SectionIdx], Build.Settings);
+			}
+		}
+
+		AsyncTask(ENamedThreads::GameThread, [AsyncBuild]()
+		{
+			FinishAsyncBuild(AsyncBuild);
+		});
+	});
+}
+
+void FVectorShapeMeshBuilder::CancelAsyncBuild(AVectorShapeActor* VectorShapeActor)
+{
+	if (VectorShapeActor->AsyncMeshBuild.IsValid())
+	{
+		VectorShapeActor->AsyncMeshBuild->bCancelled = true;
+		VectorShapeActor->AsyncMeshBuild.Reset();
+	}
+	VectorShapeActor->bAsyncMeshBuildPending = false;
+}
+
+void FVectorShapeMeshBuilder::FinishAsyncBuild(const TSharedRef<FVectorShapeAsyncMeshBuild, ESPMode::ThreadSafe>& AsyncBuild)
+{
+	check(IsInGameThread());
+
+	AVectorShapeActor* VectorShapeActor = AsyncBuild->Actor.Get();
+
+	// Cancelled, or superseded by a game thread build
+	if (AsyncBuild->bCancelled || VectorShapeActor == nullptr || VectorShapeActor->AsyncMeshBuild.Get() != &AsyncBuild.Get())
+	{
+		return;
+	}
+
+	VectorShapeActor->AsyncMeshBuild.Reset();
+
+	// Hand the caches back so the next builds only regenerate what changed since the snapshot
+	for (const FVectorSplineBuildData& Spline : AsyncBuild->Splines)
+	{
+		if (UVectorSplineComponent* SplineComp = Spline.SplineComponent.Get())
+		{
+			SplineComp->MeshCache = MoveTemp(*Spline.MeshCache);
+		}
+	}
+
+	UVectorMeshComponent* VectorMeshComp = VectorShapeActor->GetMeshComponent();
+	VectorMeshComp->SetMeshSections(MoveTemp(AsyncBuild->MeshSections));
+	VectorShapeActor->MeshSplineLayout = MoveTemp(AsyncBuild->MeshSplineLayout);
+	VectorMeshBuild::ApplyDefaultMaterials(VectorMeshComp);
+	VectorMeshBuild::SetBuildReport(VectorShapeActor, MoveTemp(AsyncBuild->Report));
+
+	if (VectorShapeActor->bAsyncMeshBuildPending)
+	{
+		VectorShapeActor->bAsyncMeshBuildPending = false;
+		BuildVectorShapeMeshAsync(VectorShapeActor, VectorShapeActor->bAsyncMeshBuildPendingPreview);
+	}
+}
+
+
+//////////////////////////////////////////////////////////////////////////
+
+
+void UVectorShapeMeshBuilderLibrary::RebuildVectorShapeMesh(AVectorShapeActor* VectorShapeActor)
+{
+	FVectorShapeMeshBuilder::BuildVectorShapeMesh(VectorShapeActor);
+}
+
+void UVectorShapeMeshBuilderLibrary::FlattenVectorSpline(const UVectorSplineComponent* SplineComponent, const FVectorShapeMeshBuildSettings& Settings, TArray<FVector2D>& OutContour)
+{
+	OutContour.Reset();
+	if (SplineComponent != nullptr)
+	{
+		FVectorShapeMeshBuilder::FlattenSpline(SplineComponent->SplineCurves, Settings, OutContour);
+	}
+}
+
+bool UVectorShapeMeshBuilderLibrary::TriangulatePolygon(const TArray<FVector2D>& Polygon, EVectorTriangulationMethod Method, TArray<int32>& OutIndices)
+{
+	TArray<uint32> Indices;
+	const bool bTriangulated = FPolygonTools::TriangulatePolygon(Polygon, Indices, 0, Method);
+
+	OutIndices.SetNumUninitialized(Indices.Num());
+	for (int32 Idx = 0; Idx < Indices.Num(); Idx++)
+	{
+		OutIndices[Idx] = (int32)Indices[Idx];
+	}
+
+	return bTriangulated;
+}
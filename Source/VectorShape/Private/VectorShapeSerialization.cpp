@@ -0,0 +1,157 @@
+//==========================================================================//
+// Copyright Elhoussine Mehnik (ue4resources@gmail.com). All Rights Reserved.
+//================== http://unrealengineresources.com/ =====================//
+
+#include "VectorShapeSerialization.h"
+#include "HAL/IConsoleManager.h"
+#include "Serialization/MemoryWriter.h"
+#include "Serialization/MemoryReader.h"
+#include "Math/RandomStream.h"
+#include "VectorMeshComponent.h"
+#include "VectorShapeTypes.h"
+
+
+static TAutoConsoleVariable<int32> CVarVectorShapeCompressBulkData(
+	TEXT("VectorShape.CompressBulkData"),
+	0,
+	TEXT("If non zero, vector mesh sections and slate vector shape data are saved zlib compressed. Smaller packages, slower loads."),
+	ECVF_Default);
+
+
+bool VectorShapeSerialization::ShouldCompressBulkData(const FArchive& Ar)
+{
+	return Ar.IsSaving() && Ar.IsPersistent() && CVarVectorShapeCompressBulkData.GetValueOnAnyThread() != 0;
+}
+
+void VectorShapeSerialization::SerializeBulkBlock(FArchive& Ar, bool bCompress, TFunctionRef<void(FArchive&)> SerializeArrays)
+{
+	bool bCompressed = Ar.IsSaving() && bCompress;
+	Ar << bCompressed;
+
+	if (!bCompressed)
+	{
+		SerializeArrays(Ar);
+		return;
+	}
+
+	TArray<uint8> Block;
+	if (Ar.IsSaving())
+	{
+		FMemoryWriter BlockWriter(Block);
+		BlockWriter.SetByteSwapping(Ar.IsByteSwapping());
+		SerializeArrays(BlockWriter);
+	}
+
+	int64 BlockSize = Block.Num();
+	Ar << BlockSize;
+
+	if (Ar.IsLoading())
+	{
+		if (BlockSize < 0 || BlockSize > MAX_int32)
+		{
+			Ar.SetError();
+			return;
+		}
+		Block.SetNumUninitialized((int32)BlockSize);
+	}
+
+	Ar.SerializeCompressed(Block.GetData(), BlockSize, NAME_Zlib, COMPRESS_BiasSpeed);
+
+	if (Ar.IsLoading())
+	{
+		FMemoryReader BlockReader(Block);
+		BlockReader.SetByteSwapping(Ar.IsByteSwapping());
+		SerializeArrays(BlockReader);
+	}
+}
+
+
+#if !UE_BUILD_SHIPPING
+
+static void BenchmarkMeshSerialization(const TArray<FString>& Args)
+{
+	const int32 NumVertices = Args.Num() > 0 ? FMath::Max(3, FCString::Atoi(*Args[0])) : 100000;
+	const int32 NumIterations = 10;
+
+	FVectorShapeMeshSection SourceSection;
+	{
+		FRandomStream RandomStream(0x5eed);
+		SourceSection.Vertices.SetNumUninitialized(NumVertices);
+		SourceSection.TextureCoordinates.SetNumUninitialized(NumVertices);
+		SourceSection.VertexColors.SetNumUninitialized(NumVertices);
+		for (int32 VertIdx = 0; VertIdx < NumVertices; VertIdx++)
+		{
+			const FVector Position(RandomStream.FRandRange(-1000.0f, 1000.0f), RandomStream.FRandRange(-1000.0f, 1000.0f), (VertIdx / 64) * 0.01f);
+			SourceSection.Vertices[VertIdx] = Position;
+			SourceSection.TextureCoordinates[VertIdx] = FVector2D(Position.X, Position.Y) / 2000.0f + FVector2D(0.5f, 0.5f);
+			SourceSection.VertexColors[VertIdx] = FColor(255, 128, (VertIdx / 64) & 0xff, 255);
+			SourceSection.SectionLocalBox += Position;
+		}
+
+		SourceSection.Indices.SetNumUninitialized(NumVertices * 3);
+		for (int32 Index = 0; Index < SourceSection.Indices.Num(); Index++)
+		{
+			SourceSection.Indices[Index] = RandomStream.RandHelper(NumVertices);
+		}
+
+		SourceSection.Normals.Add(FVector::UpVector);
+		SourceSection.Tangents.Add(FVector::ForwardVector);
+	}
+
+	UScriptStruct* SectionStruct = FVectorShapeMeshSection::StaticStruct();
+
+	auto Measure = [&](const TCHAR* Name, TFunctionRef<void(FArchive&, FVectorShapeMeshSection&)> SerializeSection)
+	{
+		TArray<uint8> Bytes;
+		double SaveTime = 0.0;
+		double LoadTime = 0.0;
+		bool bRoundTrip = true;
+
+		for (int32 Iteration = 0; Iteration < NumIterations; Iteration++)
+		{
+			Bytes.Reset();
+
+			const double SaveStart = FPlatformTime::Seconds();
+			{
+				FMemoryWriter Writer(Bytes);
+				SerializeSection(Writer, SourceSection);
+			}
+			SaveTime += FPlatformTime::Seconds() - SaveStart;
+
+			FVectorShapeMeshSection LoadedSection;
+			const double LoadStart = FPlatformTime::Seconds();
+			{
+				FMemoryReader Reader(Bytes);
+				SerializeSection(Reader, LoadedSection);
+			}
+			LoadTime += FPlatformTime::Seconds() - LoadStart;
+
+			bRoundTrip &= LoadedSection.Vertices == SourceSection.Vertices && LoadedSection.Indices == SourceSection.Indices && LoadedSection.VertexColors == SourceSection.VertexColors;
+		}
+
+		UE_LOG(LogVectorShape, Display, TEXT("Mesh section serialization, %s, %d vertices : %.2f MB, save %.3f ms, load %.3f ms%s"),
+			Name, NumVertices, Bytes.Num() / (1024.0 * 1024.0), SaveTime * 1000.0 / NumIterations, LoadTime * 1000.0 / NumIterations, bRoundTrip ? TEXT("") : TEXT(", ROUND TRIP MISMATCH"));
+	};
+
+	Measure(TEXT("tagged properties"), [SectionStruct](FArchive& Ar, FVectorShapeMeshSection& Section)
+	{
+		SectionStruct->SerializeTaggedProperties(Ar, (uint8*)&Section, SectionStruct, nullptr);
+	});
+
+	Measure(TEXT("bulk"), [](FArchive& Ar, FVectorShapeMeshSection& Section)
+	{
+		Section.SerializeBulkData(Ar, false);
+	});
+
+	Measure(TEXT("bulk compressed"), [](FArchive& Ar, FVectorShapeMeshSection& Section)
+	{
+		Section.SerializeBulkData(Ar, true);
+	});
+}
+
+static FAutoConsoleCommand BenchmarkMeshSerializationCommand(
+	TEXT("VectorShape.BenchmarkMeshSerialization"),
+	TEXT("Compares tagged, bulk and compressed bulk serialization of a synthetic vector mesh section. Optional argument : vertex count (default 100000)."),
+	FConsoleCommandWithArgsDelegate::CreateStatic(&BenchmarkMeshSerialization));
+
+#endif // !UE_BUILD_SHIPPING
@@ -0,0 +1,21 @@
+//==========================================================================//
+// Copyright Elhoussine Mehnik (ue4resources@gmail.com). All Rights Reserved.
+//================== http://unrealengineresources.com/ =====================//
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Templates/Function.h"
+
+
+namespace VectorShapeSerialization
+{
+	/** True if bulk arrays saved to the archive should be compressed, see VectorShape.CompressBulkData. */
+	bool ShouldCompressBulkData(const FArchive& Ar);
+
+	/**
+	 * Serializes what SerializeArrays writes as one block, zlib compressed when saving with bCompress.
+	 * Whether the block was compressed is stored with it, loading does not depend on bCompress.
+	 */
+	void SerializeBulkBlock(FArchive& Ar, bool bCompress, TFunctionRef<void(FArchive&)> SerializeArrays);
+}
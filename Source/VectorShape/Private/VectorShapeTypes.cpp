@@ -6,7 +6,6 @@
 
 
 #ifdef WITH_EDITOR
-FVectorShapeEditorDelegates::FOnCreateVectorMesh FVectorShapeEditorDelegates::OnCreateVectorMeshDelegate;
 FVectorShapeEditorDelegates::FOnVectorDataAssetChanged FVectorShapeEditorDelegates::OnVectorDataAssetChangedDelegate;
 
 #endif // WITH_EDITOR
@@ -13,6 +13,9 @@ UVectorSplineComponent::UVectorSplineComponent(const FObjectInitializer& ObjectI
 	, OffsetZ(0.0f)
 	, SplineType(EVectorSplineType::Polygon)
 	, bDrawMesh(true)
+	, bIsHole(false)
+	, BooleanMode(EVectorSplineBooleanMode::Layer)
+	, MaterialSlot(0)
 #if WITH_EDITORONLY_DATA
 	, AdditiveSplineSegmentColor(FLinearColor(0.25f, 0.25f, 1.0f))
 	, SubtractiveSplineSegmentColor(FLinearColor(1.0f, 0.25f, 0.25f))
@@ -35,11 +38,39 @@ void UVectorSplineComponent::PostEditChangeProperty(FPropertyChangedEvent& Prope
 
 	if (AVectorShapeActor* SplineOwner = Cast<AVectorShapeActor>(GetOwner()))
 	{
-		SplineOwner->RebuildVectorShapeMesh();
+		// Interactive changes come from dragging in the viewport, only previewed until the drag ends
+		if (PropertyChangedEvent.ChangeType == EPropertyChangeType::Interactive)
+		{
+			SplineOwner->RequestPreviewMeshRebuild();
+		}
+		else
+		{
+			SplineOwner->RebuildVectorShapeMesh();
+		}
 	}
 }
 #endif //WITH_EDITOR
 
+void UVectorSplineComponent::PostLoad()
+{
+	Super::PostLoad();
+
+	// Older actors saved the editor only flag on their splines, it is now derived from the actor
+	if (Cast<AVectorShapeActor>(GetOwner()))
+	{
+		bIsEditorOnly = false;
+	}
+}
+
+bool UVectorSplineComponent::IsEditorOnly() const
+{
+	if (const AVectorShapeActor* SplineOwner = Cast<AVectorShapeActor>(GetOwner()))
+	{
+		return !SplineOwner->bRebuildAtRuntime;
+	}
+	return Super::IsEditorOnly();
+}
+
 
 void UVectorSplineComponent::InitSpline(const FVector& InLocation, const FVector2D& InExtent, const FColor& InColor, EVectorSplineType InType, bool bDraw)
 {
@@ -80,6 +111,9 @@ void UVectorSplineComponent::CheckSpline()
 	//
 	OffsetZ = FMath::Max<float>(OffsetZ, 0.0f);
 
+	//
+	MaterialSlot = FMath::Clamp<int32>(MaterialSlot, 0, MaxMaterialSlots - 1);
+
 	//
 	const bool bForceClosed = (SplineType == EVectorSplineType::Polygon);
 	SetClosedLoop(bForceClosed, true);
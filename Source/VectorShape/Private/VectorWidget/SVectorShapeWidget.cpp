@@ -14,6 +14,8 @@
 #include "SlateMaterialBrush.h"
 #include "Math/TransformCalculus2D.h"
 #include "VectorShapeTypes.h"
+#include "VectorWidget/SlateVectorVertexTransform.h"
+#include "VectorWidget/SlateVectorShapeRenderData.h"
 
 
 
@@ -22,63 +24,16 @@ DECLARE_CYCLE_STAT(TEXT("Init Widget Render Data From Asset"), STAT_VectorWidget
 DECLARE_CYCLE_STAT(TEXT("Allocate Widget Vertices"), STAT_VectorWidget_ReallocateVertices, STATGROUP_VectorWidget);
 
 
-static void VectorMeshToSlateRenderData(const USlateVectorShapeData& DataSource, TArray<FSlateVertex>& OutSlateVerts, TArray<SlateIndex>& OutIndexes)
+bool SVectorShapeWidget::FRenderData::IsValid() const
 {
-	// Populate Index data
-	{
-		// Note that we do a slow copy because on some platforms the SlateIndex is
-		// a 16-bit value, so we cannot do a memcopy.
-		const TArray<uint32>& IndexDataSource = DataSource.GetIndexData();
-		const int32 NumIndexes = IndexDataSource.Num();
-		OutIndexes.Empty();
-		OutIndexes.Reserve(NumIndexes);
-		for (int32 i = 0; i < NumIndexes; ++i)
-		{
-			OutIndexes.Add(IndexDataSource[i]);
-		}
-	}
-
-	// Populate Vertex Data
-	{
-		const TArray<FSlateVectorMeshVertex> VertexDataSource = DataSource.GetVertexData();
-		const uint32 NumVerts = VertexDataSource.Num();
-		OutSlateVerts.Empty();
-		OutSlateVerts.Reserve(NumVerts);
-
-		for (uint32 i = 0; i < NumVerts; ++i)
-		{
-			const FSlateVectorMeshVertex& SourceVertex = VertexDataSource[i];
-			FSlateVertex& NewVert = OutSlateVerts[OutSlateVerts.AddUninitialized()];
-
-			// Copy Position
-			{
-				NewVert.Position[0] = SourceVertex.Position.X;
-				NewVert.Position[1] = SourceVertex.Position.Y;
-			}
-
-			// Copy Color
-			{
-				NewVert.Color = FColor(SourceVertex.Color);
-			}
-
-			// Copy all the UVs that we have, and as many as we can fit.
-			{
-				NewVert.TexCoords[0] = 0.5f + NewVert.Position[0] / 2.0f;
-				NewVert.TexCoords[1] = 0.5f + NewVert.Position[1] / 2.0f;
-
-				NewVert.TexCoords[2] = NewVert.Position[0] / 2.0f;
-				NewVert.TexCoords[3] = NewVert.Position[1] / 2.0f;
-
-				NewVert.MaterialTexCoords[0] = 1.0f;
-				NewVert.MaterialTexCoords[1] = 1.0f;
-			}
-		}
-	}
+	return Brush.IsValid() && MeshData.IsValid() && MeshData->IsValid();
 }
 
 void SVectorShapeWidget::Construct(const FArguments& Args)
 {
 	CachedWorldSize = FVector2D(1, 1);
+	CachedLocalSize = FVector2D::ZeroVector;
+	bTransformedVerticesValid = false;
 }
 
 static const FVector2D DummyBrushSize(FVector2D(64, 64));
@@ -111,15 +66,21 @@ void SVectorShapeWidget::InitRenderData(const USlateVectorShapeData& InVectorDat
 		RenderData.Brush = MakeShareable(new FSlateMaterialBrush(*NewMID, DummyBrushSize));
 		RenderData.RenderingResourceHandle = FSlateApplication::Get().GetRenderer()->GetResourceHandle(*RenderData.Brush);
 	}
-	VectorMeshToSlateRenderData(InVectorDataAsset, RenderData.VertexData, RenderData.IndexData);
+
+	RenderData.MeshData = FSlateVectorShapeRenderDataCache::FindOrCreate(InVectorDataAsset);
+
+	// Colors and UVs never change, the transform only writes positions
+	ResizeRenderDataArray(TransformedVertexData, [&]() { TransformedVertexData = RenderData.MeshData->VertexData; });
+	bTransformedVerticesValid = false;
 }
 
 
 void SVectorShapeWidget::ClearRenderData()
 {
-	RenderData.VertexData.Empty();
-	RenderData.IndexData.Empty();
+	RenderData.MeshData.Reset();
 	RenderData.Brush.Reset();
+	TransformedVertexData.Empty();
+	bTransformedVerticesValid = false;
 }
 
 void SVectorShapeWidget::UpdateLinesData(const TArray<FVectorLineData>& InLinesData)
@@ -196,15 +157,19 @@ int32 SVectorShapeWidget::OnPaint(const FPaintArgs& Args, const FGeometry& Allot
 	if (RenderData.IsValid())
 	{
 		{
-			TArray<FSlateVertex> TransformedVertexData;
+			// Vertices only move when the widget geometry does
+			const FSlateRenderTransform& RenderTransform = AllottedGeometry.GetAccumulatedRenderTransform();
+			const FVector2D LocalSize = AllottedGeometry.GetLocalSize();
+			if (!bTransformedVerticesValid || !(CachedRenderTransform == RenderTransform) || CachedLocalSize != LocalSize)
 			{
 				SCOPE_CYCLE_COUNTER(STAT_VectorWidget_ReallocateVertices);
 
-				TransformedVertexData = RenderData.VertexData;
-				for (FSlateVertex& NewSlateVert : TransformedVertexData)
-				{
-					NewSlateVert.Position = FVector2f(AbsoluteOffset + Matrix2D.TransformPoint(FVector2D(NewSlateVert.Position) * GeomLocalExtent));
-				}
+				const FSlateVectorShapeRenderData& MeshData = *RenderData.MeshData;
+				FSlateVectorVertexTransform::TransformPositions(MeshData.PositionsX.GetData(), MeshData.PositionsY.GetData(), TransformedVertexData.Num(), AbsoluteOffset, Matrix2D, GeomLocalExtent, TransformedVertexData.GetData());
+
+				CachedRenderTransform = RenderTransform;
+				CachedLocalSize = LocalSize;
+				bTransformedVerticesValid = true;
 			}
 
 			FSlateDrawElement::MakeCustomVerts(
@@ -212,7 +177,7 @@ int32 SVectorShapeWidget::OnPaint(const FPaintArgs& Args, const FGeometry& Allot
 				LayerId,
 				RenderData.RenderingResourceHandle,
 				TransformedVertexData,
-				RenderData.IndexData,
+				RenderData.MeshData->IndexData,
 				nullptr, 0, 0,
 				ESlateDrawEffect::None);
 		}
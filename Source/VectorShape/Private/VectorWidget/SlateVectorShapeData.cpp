@@ -9,6 +9,10 @@
 #include "VectorShapeTypes.h"
 #include "VectorMeshComponent.h"
 #include "UObject/ConstructorHelpers.h"
+#include "Algo/StableSort.h"
+#include "VectorShapeCustomVersion.h"
+#include "VectorShapeSerialization.h"
+#include "VectorWidget/SlateVectorShapeRenderData.h"
 
 
 
@@ -17,6 +21,7 @@
 USlateVectorShapeData::USlateVectorShapeData(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
 	, MeshSize(ForceInit)
+	, RenderDataRevision(0)
 {
 	VertexData.Empty();
 	IndexData.Empty();
@@ -37,11 +42,197 @@ const FVector2D& USlateVectorShapeData::GetMeshSize() const
 	return MeshSize;
 }
 
+uint32 USlateVectorShapeData::GetRenderDataRevision() const
+{
+	return RenderDataRevision;
+}
+
+void USlateVectorShapeData::Serialize(FArchive& Ar)
+{
+	Ar.UsingCustomVersion(FVectorShapeCustomVersion::GUID);
+
+	// Vertex and index arrays are written as raw blocks after the tagged properties, which then only see empty arrays
+	const bool bBulkSerialize = (Ar.IsLoading() || Ar.IsSaving()) && FVectorShapeCustomVersion::IsAtLeast(Ar, FVectorShapeCustomVersion::BulkSerializedMeshData);
+
+	TArray<FSlateVectorMeshVertex> SavedVertexData;
+	TArray<uint32> SavedIndexData;
+	if (bBulkSerialize && Ar.IsSaving())
+	{
+		SavedVertexData = MoveTemp(VertexData);
+		SavedIndexData = MoveTemp(IndexData);
+	}
+
+	Super::Serialize(Ar);
+
+	if (bBulkSerialize)
+	{
+		if (Ar.IsSaving())
+		{
+			VertexData = MoveTemp(SavedVertexData);
+			IndexData = MoveTemp(SavedIndexData);
+		}
+
+		// Cooked packages only carry the slate payload written below, the source arrays are stripped
+		const bool bStripSourceData = Ar.IsSaving() && Ar.IsCooking();
+
+		VectorShapeSerialization::SerializeBulkBlock(Ar, VectorShapeSerialization::ShouldCompressBulkData(Ar), [this, bStripSourceData](FArchive& BlockAr)
+		{
+			TArray<FSlateVectorMeshVertex> StrippedVertexData;
+			TArray<uint32> StrippedIndexData;
+
+			// Vertices are padded in memory, they are written element wise
+			BlockAr << (bStripSourceData ? StrippedVertexData : VertexData);
+			(bStripSourceData ? StrippedIndexData : IndexData).BulkSerialize(BlockAr);
+		});
+	}
+
+	if (!FVectorShapeCustomVersion::IsAtLeast(Ar, FVectorShapeCustomVersion::AddedCookedSlateRenderData) || !(Ar.IsLoading() || Ar.IsSaving()))
+	{
+		return;
+	}
+
+	// Cooked packages carry the final slate layout so widgets don't have to convert it at runtime
+	bool bHasCookedData = Ar.IsCooking();
+	Ar << bHasCookedData;
+	if (!bHasCookedData)
+	{
+		return;
+	}
+
+	TArray<FSlateVertex> SlateVertices;
+	TArray<SlateIndex> SlateIndices;
+	if (Ar.IsSaving())
+	{
+		ConvertToSlateRenderData(SlateVertices, SlateIndices);
+	}
+
+	int32 VertexSize = sizeof(FSlateVertex);
+	int32 IndexSize = sizeof(SlateIndex);
+	int32 NumVertices = SlateVertices.Num();
+	int32 NumIndices = SlateIndices.Num();
+	Ar << VertexSize << IndexSize << NumVertices << NumIndices;
+
+	if (Ar.IsLoading())
+	{
+		if (VertexSize != sizeof(FSlateVertex) || IndexSize != sizeof(SlateIndex))
+		{
+			// Cooked with a different slate vertex layout, and the source arrays were stripped
+			UE_LOG(LogVectorShape, Warning, TEXT("%s : cooked slate render data layout mismatch, the asset has to be recooked to be drawn."), *GetPathName());
+			Ar.Seek(Ar.Tell() + (int64)VertexSize * NumVertices + (int64)IndexSize * NumIndices);
+			return;
+		}
+
+		SlateVertices.SetNumUninitialized(NumVertices);
+		SlateIndices.SetNumUninitialized(NumIndices);
+	}
+
+	Ar.Serialize(SlateVertices.GetData(), (int64)NumVertices * sizeof(FSlateVertex));
+	Ar.Serialize(SlateIndices.GetData(), (int64)NumIndices * sizeof(SlateIndex));
+
+	if (Ar.IsLoading())
+	{
+		CookedSlateVertices = MoveTemp(SlateVertices);
+		CookedSlateIndices = MoveTemp(SlateIndices);
+	}
+}
+
+#if WITH_EDITOR
+void USlateVectorShapeData::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+
+	// Also reached after undo / redo, which may have restored older vertex data
+	RenderDataRevision++;
+}
+#endif
+
+bool USlateVectorShapeData::HasCookedSlateRenderData() const
+{
+	return CookedSlateVertices.Num() > 0 && CookedSlateIndices.Num() > 0;
+}
+
+void USlateVectorShapeData::GetSlateRenderData(TArray<FSlateVertex>& OutSlateVerts, TArray<SlateIndex>& OutIndexes) const
+{
+	if (HasCookedSlateRenderData())
+	{
+		ResizeRenderDataArray(OutSlateVerts, [&]() { OutSlateVerts.SetNumUninitialized(CookedSlateVertices.Num()); });
+		FMemory::Memcpy(OutSlateVerts.GetData(), CookedSlateVertices.GetData(), CookedSlateVertices.Num() * sizeof(FSlateVertex));
+
+		ResizeRenderDataArray(OutIndexes, [&]() { OutIndexes.SetNumUninitialized(CookedSlateIndices.Num()); });
+		FMemory::Memcpy(OutIndexes.GetData(), CookedSlateIndices.GetData(), CookedSlateIndices.Num() * sizeof(SlateIndex));
+	}
+	else
+	{
+		ConvertToSlateRenderData(OutSlateVerts, OutIndexes);
+	}
+}
+
+void USlateVectorShapeData::ConvertToSlateRenderData(TArray<FSlateVertex>& OutSlateVerts, TArray<SlateIndex>& OutIndexes) const
+{
+	// Populate Index data
+	{
+		const int32 NumIndexes = IndexData.Num();
+		ResizeRenderDataArray(OutIndexes, [&]() { OutIndexes.SetNumUninitialized(NumIndexes); });
+
+		if constexpr (sizeof(SlateIndex) == sizeof(uint32))
+		{
+			FMemory::Memcpy(OutIndexes.GetData(), IndexData.GetData(), NumIndexes * sizeof(uint32));
+		}
+		else
+		{
+			// On some platforms the SlateIndex is a 16-bit value, so we cannot do a memcopy.
+			for (int32 i = 0; i < NumIndexes; ++i)
+			{
+				OutIndexes[i] = (SlateIndex)IndexData[i];
+			}
+		}
+	}
+
+	// Populate Vertex Data
+	{
+		const int32 NumVerts = VertexData.Num();
+		// Zeroed so the attributes left unset are deterministic in cooked packages and in the shader
+		ResizeRenderDataArray(OutSlateVerts, [&]() { OutSlateVerts.SetNumZeroed(NumVerts); });
+
+		for (int32 i = 0; i < NumVerts; ++i)
+		{
+			const FSlateVectorMeshVertex& SourceVertex = VertexData[i];
+			FSlateVertex& NewVert = OutSlateVerts[i];
+
+			// Copy Position
+			{
+				NewVert.Position[0] = SourceVertex.Position.X;
+				NewVert.Position[1] = SourceVertex.Position.Y;
+			}
+
+			// Copy Color
+			{
+				NewVert.Color = FColor(SourceVertex.Color);
+			}
+
+			// Copy all the UVs that we have, and as many as we can fit.
+			{
+				NewVert.TexCoords[0] = 0.5f + NewVert.Position[0] / 2.0f;
+				NewVert.TexCoords[1] = 0.5f + NewVert.Position[1] / 2.0f;
+
+				NewVert.TexCoords[2] = NewVert.Position[0] / 2.0f;
+				NewVert.TexCoords[3] = NewVert.Position[1] / 2.0f;
+
+				NewVert.MaterialTexCoords[0] = 1.0f;
+				NewVert.MaterialTexCoords[1] = 1.0f;
+			}
+		}
+	}
+}
+
 void USlateVectorShapeData::InitFromVectorCustomMesh(const FVectorShapeMeshSection* InMeshSection, const FVector2D& InVectorSize)
 {
 	VertexData.Empty();
 	IndexData.Empty();
+	CookedSlateVertices.Empty();
+	CookedSlateIndices.Empty();
 	MeshSize = InVectorSize;
+	RenderDataRevision++;
 
 
 	if (InVectorSize.X <= 0 || InVectorSize.Y <= 0)
@@ -63,54 +254,43 @@ void USlateVectorShapeData::InitFromVectorCustomMesh(const FVectorShapeMeshSecti
 		{
 			const FVector2D TexCoordOffset(0.5f, 0.5f);
 			const FVector2D VectorExtent = MeshSize / 2.0f;
-			const uint32 NumVerts = InMeshSection->Vertices.Num();
-			VertexData.Empty();
-			VertexData.Reserve(NumVerts);
+			const TArray<FVector>& SourceVertices = InMeshSection->Vertices;
+			const TArray<FColor>& SourceColors = InMeshSection->VertexColors;
+			const int32 NumVerts = SourceVertices.Num();
+			VertexData.SetNumUninitialized(NumVerts);
 
-			for (uint32 i = 0; i < NumVerts; ++i)
+			for (int32 i = 0; i < NumVerts; ++i)
 			{
-				// Copy Position
-				const FVector& Position = InMeshSection->Vertices[i];
-
-				// Copy Color
-				const FColor& Color = InMeshSection->VertexColors[i];
-
-				VertexData.Add(FSlateVectorMeshVertex(
-					FVector2D(Position.X, Position.Y) / VectorExtent,
-					Color.DWColor()
-				));
+				const FVector& Position = SourceVertices[i];
+				VertexData[i] = FSlateVectorMeshVertex(FVector2D(Position.X, Position.Y) / VectorExtent, SourceColors[i].DWColor());
 			}
 		}
 
 		// Populate Index data
 		{
-			const TArray<uint32> SourceIndexes = InMeshSection->Indices;
+			const TArray<uint32>& SourceIndexes = InMeshSection->Indices;
 			const int32 NumIndexes = SourceIndexes.Num();
-			IndexData.Empty();
-			IndexData.Reserve(NumIndexes);
-			for (int32 i = 0; i < NumIndexes; ++i)
+			ensure(NumIndexes % 3 == 0);
+			const int32 NumTriangles = NumIndexes / 3;
+
+			// Sort the index buffer such that verts are drawn in Z-order, keeping the mesh order for equal depths.
+			// Assume that all triangles are coplanar with Z == SomeValue.
+			TArray<int32> TriangleOrder;
+			TriangleOrder.SetNumUninitialized(NumTriangles);
+			for (int32 TriIdx = 0; TriIdx < NumTriangles; ++TriIdx)
 			{
-				IndexData.Add(SourceIndexes[i]);
+				TriangleOrder[TriIdx] = TriIdx;
 			}
 
+			Algo::StableSortBy(TriangleOrder, [&](int32 TriIdx) { return InMeshSection->Vertices[SourceIndexes[TriIdx * 3]].Z; });
 
-			// Sort the index buffer such that verts are drawn in Z-order.
-			// Assume that all triangles are coplanar with Z == SomeValue.
-			ensure(NumIndexes % 3 == 0);
-			for (int32 a = 0; a < NumIndexes; a += 3)
+			IndexData.SetNumUninitialized(NumTriangles * 3);
+			for (int32 i = 0; i < NumTriangles; ++i)
 			{
-				for (int32 b = 0; b < NumIndexes; b += 3)
-				{
-					const float VertADepth = InMeshSection->Vertices[IndexData[a]].Z;
-					const float VertBDepth = InMeshSection->Vertices[IndexData[b]].Z;
-					if (VertADepth < VertBDepth)
-					{
-						// Swap the order in which triangles will be drawn
-						Swap(IndexData[a + 0], IndexData[b + 0]);
-						Swap(IndexData[a + 1], IndexData[b + 1]);
-						Swap(IndexData[a + 2], IndexData[b + 2]);
-					}
-				}
+				const int32 SourceIdx = TriangleOrder[i] * 3;
+				IndexData[i * 3 + 0] = SourceIndexes[SourceIdx + 0];
+				IndexData[i * 3 + 1] = SourceIndexes[SourceIdx + 1];
+				IndexData[i * 3 + 2] = SourceIndexes[SourceIdx + 2];
 			}
 		}
 	}
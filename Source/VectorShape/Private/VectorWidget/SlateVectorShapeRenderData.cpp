@@ -0,0 +1,65 @@
+//==========================================================================//
+// Copyright Elhoussine Mehnik (ue4resources@gmail.com). All Rights Reserved.
+//================== http://unrealengineresources.com/ =====================//
+
+#include "VectorWidget/SlateVectorShapeRenderData.h"
+#include "VectorWidget/SlateVectorShapeData.h"
+#include "VectorShapeTypes.h"
+
+
+DECLARE_CYCLE_STAT(TEXT("Build Shared Widget Render Data"), STAT_VectorWidget_BuildSharedRenderData, STATGROUP_VectorWidget);
+DEFINE_STAT(STAT_VectorWidget_RenderDataAllocations);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Shared Render Data Reuses"), STAT_VectorWidget_RenderDataReuses, STATGROUP_VectorWidget);
+
+
+TMap<FObjectKey, TWeakPtr<const FSlateVectorShapeRenderData, ESPMode::ThreadSafe>> FSlateVectorShapeRenderDataCache::Entries;
+
+
+FSlateVectorShapeRenderDataPtr FSlateVectorShapeRenderDataCache::FindOrCreate(const USlateVectorShapeData& InVectorDataAsset)
+{
+	check(IsInGameThread());
+
+	const FObjectKey AssetKey(&InVectorDataAsset);
+	const uint32 Revision = InVectorDataAsset.GetRenderDataRevision();
+
+	if (const TWeakPtr<const FSlateVectorShapeRenderData, ESPMode::ThreadSafe>* ExistingEntry = Entries.Find(AssetKey))
+	{
+		FSlateVectorShapeRenderDataPtr ExistingData = ExistingEntry->Pin();
+		if (ExistingData.IsValid() && ExistingData->Revision == Revision)
+		{
+			INC_DWORD_STAT(STAT_VectorWidget_RenderDataReuses);
+			return ExistingData;
+		}
+	}
+
+	SCOPE_CYCLE_COUNTER(STAT_VectorWidget_BuildSharedRenderData);
+
+	TSharedRef<FSlateVectorShapeRenderData, ESPMode::ThreadSafe> NewData = MakeShared<FSlateVectorShapeRenderData, ESPMode::ThreadSafe>();
+	NewData->Revision = Revision;
+	InVectorDataAsset.GetSlateRenderData(NewData->VertexData, NewData->IndexData);
+
+	// Structure of arrays copy of the positions for the transform kernel
+	{
+		const int32 NumVerts = NewData->VertexData.Num();
+		ResizeRenderDataArray(NewData->PositionsX, [&]() { NewData->PositionsX.SetNumUninitialized(NumVerts); });
+		ResizeRenderDataArray(NewData->PositionsY, [&]() { NewData->PositionsY.SetNumUninitialized(NumVerts); });
+		for (int32 VertIdx = 0; VertIdx < NumVerts; VertIdx++)
+		{
+			NewData->PositionsX[VertIdx] = NewData->VertexData[VertIdx].Position.X;
+			NewData->PositionsY[VertIdx] = NewData->VertexData[VertIdx].Position.Y;
+		}
+	}
+
+	// Drop the entries of released render data before adding the new one
+	for (auto EntryIt = Entries.CreateIterator(); EntryIt; ++EntryIt)
+	{
+		if (!EntryIt.Value().IsValid())
+		{
+			EntryIt.RemoveCurrent();
+		}
+	}
+
+	Entries.Add(AssetKey, NewData);
+
+	return NewData;
+}
@@ -0,0 +1,84 @@
+//==========================================================================//
+// Copyright Elhoussine Mehnik (ue4resources@gmail.com). All Rights Reserved.
+//================== http://unrealengineresources.com/ =====================//
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/ObjectKey.h"
+#include "Rendering/RenderingCommon.h"
+#include "VectorShapeTypes.h"
+
+class USlateVectorShapeData;
+
+
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Render Data Array Allocations"), STAT_VectorWidget_RenderDataAllocations, STATGROUP_VectorWidget, );
+
+/** Resizes or assigns a render data array with Resize, counting it in the allocations stat when its storage was reallocated. */
+template<typename ElementType, typename ResizeFunctionType>
+FORCEINLINE void ResizeRenderDataArray(TArray<ElementType>& Array, ResizeFunctionType&& Resize)
+{
+#if STATS
+	const ElementType* PreviousData = Array.GetData();
+	const int32 PreviousMax = Array.Max();
+	Resize();
+	if (Array.Max() > 0 && (Array.GetData() != PreviousData || Array.Max() != PreviousMax))
+	{
+		INC_DWORD_STAT(STAT_VectorWidget_RenderDataAllocations);
+	}
+#else
+	Resize();
+#endif
+}
+
+
+/**
+ * Slate render data converted from a vector shape data asset.
+ * Immutable once built, shared by every widget drawing the same asset revision.
+ */
+struct FSlateVectorShapeRenderData
+{
+	/** Asset vertices converted to a format that Slate understands, positions are normalized to [-1, 1]. */
+	TArray<FSlateVertex> VertexData;
+
+	/** Connectivity data: Order in which the vertexes occur to make up a series of triangles. */
+	TArray<SlateIndex> IndexData;
+
+	/** Vertex positions as a structure of arrays, source of the vertex transform kernel. */
+	TArray<float> PositionsX;
+	TArray<float> PositionsY;
+
+	/** Revision of the asset this data was built from. */
+	uint32 Revision;
+
+	FSlateVectorShapeRenderData()
+		: Revision(0)
+	{
+	}
+
+	bool IsValid() const
+	{
+		return VertexData.Num() > 0 && IndexData.Num() > 0;
+	}
+};
+
+typedef TSharedPtr<const FSlateVectorShapeRenderData, ESPMode::ThreadSafe> FSlateVectorShapeRenderDataPtr;
+
+
+/**
+ * Process wide cache of the slate render data of vector shape data assets, keyed by asset.
+ * Entries are weakly held : the render data is released once the last widget using it is.
+ * Game thread only.
+ */
+class FSlateVectorShapeRenderDataCache
+{
+
+public:
+
+	/** Returns the render data of the current revision of the asset, building it if no widget shares it yet. */
+	static FSlateVectorShapeRenderDataPtr FindOrCreate(const USlateVectorShapeData& InVectorDataAsset);
+
+private:
+
+	static TMap<FObjectKey, TWeakPtr<const FSlateVectorShapeRenderData, ESPMode::ThreadSafe>> Entries;
+};
@@ -0,0 +1,135 @@
+//==========================================================================//
+// Copyright Elhoussine Mehnik (ue4resources@gmail.com). All Rights Reserved.
+//================== http://unrealengineresources.com/ =====================//
+
+#include "VectorWidget/SlateVectorVertexTransform.h"
+#include "Rendering/RenderingCommon.h"
+#include "HAL/IConsoleManager.h"
+#include "Math/RandomStream.h"
+#include "VectorShapeTypes.h"
+
+
+void FSlateVectorVertexTransform::TransformPositions(const float* PositionsX, const float* PositionsY, int32 NumVertices, const FVector2D& Offset, const FMatrix2x2& Matrix, const FVector2D& Scale, FSlateVertex* OutVertices)
+{
+	float A, B, C, D;
+	Matrix.GetMatrix(A, B, C, D);
+
+	// Fold the scale into the matrix : Out.X = Offset.X + X * A' + Y * C', Out.Y = Offset.Y + X * B' + Y * D'
+	const VectorRegister4Float XToX = VectorSetFloat1(A * (float)Scale.X);
+	const VectorRegister4Float YToX = VectorSetFloat1(C * (float)Scale.Y);
+	const VectorRegister4Float XToY = VectorSetFloat1(B * (float)Scale.X);
+	const VectorRegister4Float YToY = VectorSetFloat1(D * (float)Scale.Y);
+	const VectorRegister4Float OffsetX = VectorSetFloat1((float)Offset.X);
+	const VectorRegister4Float OffsetY = VectorSetFloat1((float)Offset.Y);
+
+	int32 VertIdx = 0;
+	for (; VertIdx + 8 <= NumVertices; VertIdx += 8)
+	{
+		const VectorRegister4Float X0 = VectorLoad(PositionsX + VertIdx);
+		const VectorRegister4Float X1 = VectorLoad(PositionsX + VertIdx + 4);
+		const VectorRegister4Float Y0 = VectorLoad(PositionsY + VertIdx);
+		const VectorRegister4Float Y1 = VectorLoad(PositionsY + VertIdx + 4);
+
+		alignas(16) float OutX[8];
+		alignas(16) float OutY[8];
+		VectorStoreAligned(VectorMultiplyAdd(X0, XToX, VectorMultiplyAdd(Y0, YToX, OffsetX)), OutX);
+		VectorStoreAligned(VectorMultiplyAdd(X1, XToX, VectorMultiplyAdd(Y1, YToX, OffsetX)), OutX + 4);
+		VectorStoreAligned(VectorMultiplyAdd(X0, XToY, VectorMultiplyAdd(Y0, YToY, OffsetY)), OutY);
+		VectorStoreAligned(VectorMultiplyAdd(X1, XToY, VectorMultiplyAdd(Y1, YToY, OffsetY)), OutY + 4);
+
+		// Positions are interleaved in the slate vertices
+		for (int32 Lane = 0; Lane < 8; Lane++)
+		{
+			OutVertices[VertIdx + Lane].Position = FVector2f(OutX[Lane], OutY[Lane]);
+		}
+	}
+
+	if (VertIdx < NumVertices)
+	{
+		TransformPositionsScalar(PositionsX + VertIdx, PositionsY + VertIdx, NumVertices - VertIdx, Offset, Matrix, Scale, OutVertices + VertIdx);
+	}
+}
+
+void FSlateVectorVertexTransform::TransformPositionsScalar(const float* PositionsX, const float* PositionsY, int32 NumVertices, const FVector2D& Offset, const FMatrix2x2& Matrix, const FVector2D& Scale, FSlateVertex* OutVertices)
+{
+	float A, B, C, D;
+	Matrix.GetMatrix(A, B, C, D);
+
+	const float XToX = A * (float)Scale.X;
+	const float YToX = C * (float)Scale.Y;
+	const float XToY = B * (float)Scale.X;
+	const float YToY = D * (float)Scale.Y;
+	const float OffsetX = (float)Offset.X;
+	const float OffsetY = (float)Offset.Y;
+
+	for (int32 VertIdx = 0; VertIdx < NumVertices; VertIdx++)
+	{
+		const float X = PositionsX[VertIdx];
+		const float Y = PositionsY[VertIdx];
+		OutVertices[VertIdx].Position = FVector2f(OffsetX + X * XToX + Y * YToX, OffsetY + X * XToY + Y * YToY);
+	}
+}
+
+
+#if !UE_BUILD_SHIPPING
+
+static void BenchmarkVectorVertexTransform()
+{
+	const int32 VertexCounts[] = { 1000, 10000, 100000 };
+	const int32 NumIterations = 200;
+
+	const float Angle = FMath::DegreesToRadians(30.0f);
+	const FMatrix2x2 Matrix(1.5f * FMath::Cos(Angle), 1.5f * FMath::Sin(Angle), -0.75f * FMath::Sin(Angle), 0.75f * FMath::Cos(Angle));
+	const FVector2D Offset(640.0, 360.0);
+	const FVector2D Scale(256.0, 128.0);
+
+	FRandomStream RandomStream(0x5eed);
+
+	for (const int32 NumVertices : VertexCounts)
+	{
+		TArray<float> PositionsX;
+		TArray<float> PositionsY;
+		PositionsX.SetNumUninitialized(NumVertices);
+		PositionsY.SetNumUninitialized(NumVertices);
+		for (int32 VertIdx = 0; VertIdx < NumVertices; VertIdx++)
+		{
+			PositionsX[VertIdx] = RandomStream.FRandRange(-1.0f, 1.0f);
+			PositionsY[VertIdx] = RandomStream.FRandRange(-1.0f, 1.0f);
+		}
+
+		TArray<FSlateVertex> ScalarVertices;
+		TArray<FSlateVertex> SimdVertices;
+		ScalarVertices.SetNumZeroed(NumVertices);
+		SimdVertices.SetNumZeroed(NumVertices);
+
+		const double ScalarStart = FPlatformTime::Seconds();
+		for (int32 Iteration = 0; Iteration < NumIterations; Iteration++)
+		{
+			FSlateVectorVertexTransform::TransformPositionsScalar(PositionsX.GetData(), PositionsY.GetData(), NumVertices, Offset, Matrix, Scale, ScalarVertices.GetData());
+		}
+		const double ScalarTime = (FPlatformTime::Seconds() - ScalarStart) / NumIterations;
+
+		const double SimdStart = FPlatformTime::Seconds();
+		for (int32 Iteration = 0; Iteration < NumIterations; Iteration++)
+		{
+			FSlateVectorVertexTransform::TransformPositions(PositionsX.GetData(), PositionsY.GetData(), NumVertices, Offset, Matrix, Scale, SimdVertices.GetData());
+		}
+		const double SimdTime = (FPlatformTime::Seconds() - SimdStart) / NumIterations;
+
+		float MaxError = 0.0f;
+		for (int32 VertIdx = 0; VertIdx < NumVertices; VertIdx++)
+		{
+			MaxError = FMath::Max(MaxError, (ScalarVertices[VertIdx].Position - SimdVertices[VertIdx].Position).GetAbsMax());
+		}
+
+		UE_LOG(LogVectorShape, Display, TEXT("Vertex transform, %6d vertices : scalar %.4f ms, simd %.4f ms, speedup x%.2f, max error %g"),
+			NumVertices, ScalarTime * 1000.0, SimdTime * 1000.0, SimdTime > 0.0 ? ScalarTime / SimdTime : 0.0, MaxError);
+	}
+}
+
+static FAutoConsoleCommand BenchmarkVectorVertexTransformCommand(
+	TEXT("VectorShape.BenchmarkVertexTransform"),
+	TEXT("Compares the scalar and vectorized vector widget vertex transforms at 1k, 10k and 100k vertices."),
+	FConsoleCommandDelegate::CreateStatic(&BenchmarkVectorVertexTransform));
+
+#endif // !UE_BUILD_SHIPPING
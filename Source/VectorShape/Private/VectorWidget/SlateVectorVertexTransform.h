@@ -0,0 +1,28 @@
+//==========================================================================//
+// Copyright Elhoussine Mehnik (ue4resources@gmail.com). All Rights Reserved.
+//================== http://unrealengineresources.com/ =====================//
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Math/TransformCalculus2D.h"
+
+struct FSlateVertex;
+
+
+/**
+ * Transforms vector widget vertices from their normalized [-1, 1] positions to absolute Slate space :
+ * Out = Offset + Matrix.TransformPoint(Position * Scale)
+ * Source positions are read from a structure of arrays cache, only the positions of the output vertices are written.
+ */
+class FSlateVectorVertexTransform
+{
+
+public:
+
+	/** Vectorized kernel, transforms 8 vertices per iteration. */
+	static void TransformPositions(const float* PositionsX, const float* PositionsY, int32 NumVertices, const FVector2D& Offset, const FMatrix2x2& Matrix, const FVector2D& Scale, FSlateVertex* OutVertices);
+
+	/** Reference kernel, one vertex at a time. */
+	static void TransformPositionsScalar(const float* PositionsX, const float* PositionsY, int32 NumVertices, const FVector2D& Offset, const FMatrix2x2& Matrix, const FVector2D& Scale, FSlateVertex* OutVertices);
+};
@@ -0,0 +1,233 @@
+//==========================================================================//
+// Copyright Elhoussine Mehnik (ue4resources@gmail.com). All Rights Reserved.
+//================== http://unrealengineresources.com/ =====================//
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "VectorShapeTypes.h"
+
+class UVectorSplineComponent;
+struct FSplineCurves;
+
+
+/** Simple polygon with holes : counter clockwise contour, clockwise holes. */
+struct FVectorPolygon
+{
+	TArray<FVector2D> Contour;
+	TArray<TArray<FVector2D>> Holes;
+};
+
+
+class VECTORSHAPE_API FPolygonTools
+{
+
+public:
+
+	/** Triangulate a polygon given a list of contour points, then places results as indices into the original polygon array.  Does not support polygons with holes. */
+	static bool TriangulatePolygon(const TArray<FVector2D>& Polygon, TArray<uint32>& TriangulatedIndices, int32 StartVertex, bool bAllowSimpleTriangulation);
+
+	/** Triangulate a polygon with the given method. Results are placed as indices into the original polygon array, offset by StartVertex. */
+	static bool TriangulatePolygon(const TArray<FVector2D>& Polygon, TArray<uint32>& TriangulatedIndices, int32 StartVertex, EVectorTriangulationMethod Method);
+
+	/** Triangulate a simple polygon by sweeping it into y-monotone pieces, then triangulating each piece with a stack walk. O(n log n). Does not support polygons with holes. */
+	static bool TriangulateMonotonePolygon(const TArray<FVector2D>& Polygon, TArray<uint32>& TriangulatedIndices, int32 StartVertex);
+
+	/**
+	 * Triangulate a polygon and the holes cut out of it. Indices assume the outer contour vertices come first,
+	 * followed by the vertices of each hole in order, all offset by StartVertex. Holes must lie inside the polygon and not overlap.
+	 */
+	static bool TriangulatePolygonWithHoles(const TArray<FVector2D>& Polygon, const TArray<TArray<FVector2D>>& Holes, TArray<uint32>& TriangulatedIndices, int32 StartVertex, EVectorTriangulationMethod Method);
+
+	/** Triangulate a polygon given a number of vertices (convex polygons ). */
+	static bool TriangulateSimplePolygon(TArray<uint32>& TriangulatedIndices, int32 NumVertices, int32 StartVertex);
+
+	/** Compute area of a polygon */
+	static inline float Area(const TArray<FVector2D>& Polygon);
+
+	/** Determines if the specified point is inside the triangle defined by the three triangle corners */
+	static inline bool IsPointInsideTriangle(const FVector2D TriangleA, const FVector2D TriangleB, const FVector2D TriangleC, const FVector2D Point);
+
+	/** Given a 2D polygon and a point, determines whether the point is inside the polygon.  Supports convex polygons.  If the point is exactly on the polygon boundary, the return value could be either false or true. */
+	static inline bool IsPointInsidePolygon(const TArray<FVector2D>& Polygon, const FVector2D Point);
+
+	static inline bool IsPolygonConvex(const TArray<FVector2D>& Points);
+
+	static void  RemoveCollinearPoints(TArray<FVector2D>& PointList);
+
+	static void  RemoveDuplicatedPoints(TArray<FVector2D>& PointList);
+
+	/** Removes duplicated points, collinear points and zero area spikes of a closed polygon in a single pass. */
+	static void  CleanPolygon(TArray<FVector2D>& PointList);
+
+	/**
+	 * Finds the points where edges of a closed polygon cross or touch with a Bentley-Ottmann sweep, in O((n + k) log n) searches for k crossings.
+	 * The sweep status is a sorted array, each edge entering or leaving it shifts the edges above, so the worst case is O(n^2).
+	 * A point lying on another edge, or on another point of the outline, is reported as a crossing at the start of the edges leaving it,
+	 * overlapping edges as the two points where the overlap ends. Returns true if the polygon crosses or touches itself.
+	 */
+	static bool FindSelfIntersections(const TArray<FVector2D>& Polygon, TArray<FPolygonEdgeCrossing>& OutCrossings);
+
+	/** Whether every point of Inner lies inside Outer and no edge of Inner meets an edge of Outer, as required of the holes of TriangulatePolygonWithHoles. */
+	static bool IsPolygonInsidePolygon(const TArray<FVector2D>& Inner, const TArray<FVector2D>& Outer);
+
+	/**
+	 * Splits a polygon at its crossings into simple polygons with holes, covering the regions the fill rule keeps inside it.
+	 * Crossings are the ones FindSelfIntersections reported for this polygon.
+	 */
+	static void SplitSelfIntersections(const TArray<FVector2D>& Polygon, const TArray<FPolygonEdgeCrossing>& Crossings, EVectorFillRule FillRule, TArray<FVectorPolygon>& OutPolygons);
+
+	/**
+	 * Boolean operation between two sets of polygons with holes, each set free of overlaps and self crossings.
+	 * Edges are split where the sets cross or touch, found with the same sweep as FindSelfIntersections, then the pieces the operation leaves on the boundary are chained into the result.
+	 * Each run of pieces between two such points is tested for the side of the other set it lies on, edges both sets run along are kept once or dropped depending on the sides their interiors are on.
+	 */
+	static void ClipPolygons(const TArray<FVectorPolygon>& Subject, const TArray<FVectorPolygon>& Clip, EVectorBooleanOperation Operation, TArray<FVectorPolygon>& OutPolygons);
+
+	/** Counter clockwise convex hull of a point set, Andrew's monotone chain. O(n log n). */
+	static void ConvexHull(const TArray<FVector2D>& Points, TArray<FVector2D>& OutHull);
+
+	static bool IsSplineWindingCCW(const UVectorSplineComponent* SplineComponent);
+
+	static bool IsSplineWindingCCW(const FInterpCurveVector& SplinePointsPosition);
+
+	/**
+	 * Ramer-Douglas-Peucker simplification of an open polyline, keeping the points deviating more than Tolerance from the simplified polyline.
+	 * Kept points are appended to OutPolyline, the last point only if bAppendLastPoint is set.
+	 */
+	static void SimplifyPolyline(TArrayView<const FVector2D> Polyline, float Tolerance, TArray<FVector2D>& OutPolyline, bool bAppendLastPoint);
+
+	/** Flattens the spline curve into a counter clockwise outline, simplified with the method of the build settings. */
+	static void  SimplifySplinePolygon(const FSplineCurves& SplineCurves, const FVectorShapeMeshBuildSettings& Settings, TArray<FVector2D>& OutPolygon);
+
+private:
+
+	/** Ear clipping over a contour of indices into Points. Output indices are remapped through SourceIndices when provided. */
+	static bool ClipEars(const TArray<FVector2D>& Points, TArray<int32>& VertexIndices, const uint32* SourceIndices, TArray<uint32>& TriangulatedIndices, int32 StartVertex);
+
+	/** Same as ClipEars, only testing the reflex vertices found in the grid cells each ear overlaps. */
+	static bool ClipEarsIndexed(const TArray<FVector2D>& Points, TArray<int32>& VertexIndices, const uint32* SourceIndices, TArray<uint32>& TriangulatedIndices, int32 StartVertex);
+
+	/** Clips a polygon */
+	static inline bool Snip(const TArray<FVector2D>& Polygon, const int32 U, const int32 V, const int32 W, const int32 PointCount, const int32* VertexIndices);
+};
+
+
+
+float FPolygonTools::Area(const TArray<FVector2D>& Polygon)
+{
+	const int32 PointCount = Polygon.Num();
+
+	float HalfArea = 0.0f;
+	for (int32 P = PointCount - 1, Q = 0; Q < PointCount; P = Q++)
+	{
+		HalfArea += Polygon[P].X * Polygon[Q].Y - Polygon[Q].X * Polygon[P].Y;
+	}
+	return HalfArea * 0.5f;
+}
+
+
+bool FPolygonTools::IsPointInsideTriangle(const FVector2D TriangleA, const FVector2D TriangleB, const FVector2D TriangleC, const FVector2D Point)
+{
+	const FVector2D BToC = TriangleC - TriangleB;
+	const FVector2D CToA = TriangleA - TriangleC;
+	const FVector2D AToB = TriangleB - TriangleA;
+
+	const FVector2D AToP = Point - TriangleA;
+	const FVector2D BToP = Point - TriangleB;
+	const FVector2D CToP = Point - TriangleC;
+
+	const float ACrossBP = BToC ^ BToP;
+	const float CCrossAP = AToB ^ AToP;
+	const float BCrossCP = CToA ^ CToP;
+
+	return ((ACrossBP >= -SMALL_NUMBER) && (BCrossCP >= -SMALL_NUMBER) && (CCrossAP >= -SMALL_NUMBER));
+};
+
+
+bool FPolygonTools::IsPointInsidePolygon(const TArray<FVector2D>& Polygon, const FVector2D Point)
+{
+	const int NumCorners = Polygon.Num();
+	int PreviousCornerIndex = NumCorners - 1;
+	bool bIsInside = false;
+
+	for (int CornerIndex = 0; CornerIndex < NumCorners; CornerIndex++)
+	{
+		if ((Polygon[CornerIndex].Y < Point.Y && Polygon[PreviousCornerIndex].Y >= Point.Y || Polygon[PreviousCornerIndex].Y < Point.Y && Polygon[CornerIndex].Y >= Point.Y) &&
+			(Polygon[CornerIndex].X <= Point.X || Polygon[PreviousCornerIndex].X <= Point.X))
+		{
+			bIsInside ^= (Polygon[CornerIndex].X + (Point.Y - Polygon[CornerIndex].Y) / (Polygon[PreviousCornerIndex].Y - Polygon[CornerIndex].Y)*(Polygon[PreviousCornerIndex].X - Polygon[CornerIndex].X) < Point.X);
+		}
+
+		PreviousCornerIndex = CornerIndex;
+	}
+
+	return bIsInside;
+}
+
+
+bool FPolygonTools::IsPolygonConvex(const TArray<FVector2D>& Points)
+{
+	const int PointCount = Points.Num();
+	float Sign = 0;
+	for (int32 PointIndex = 0; PointIndex < PointCount; ++PointIndex)
+	{
+		const FVector2D& A = Points[PointIndex];
+		const FVector2D& B = Points[(PointIndex + 1) % PointCount];
+		const FVector2D& C = Points[(PointIndex + 2) % PointCount];
+		float Det = (B.X - A.X) * (C.Y - B.Y) - (B.Y - A.Y) * (C.X - B.X);
+		float DetSign = FMath::Sign(Det);
+		if (DetSign != 0)
+		{
+			if (Sign == 0)
+			{
+				Sign = DetSign;
+			}
+			else if (Sign != DetSign)
+			{
+				return false;
+			}
+		}
+	}
+
+	return true;
+}
+
+bool FPolygonTools::Snip(const TArray<FVector2D>& Polygon, const int32 U, const int32 V, const int32 W, const int32 PointCount, const int32* VertexIndices)
+{
+	const FVector2D A = Polygon[VertexIndices[U]];
+	const FVector2D B = Polygon[VertexIndices[V]];
+	const FVector2D C = Polygon[VertexIndices[W]];
+
+	if (SMALL_NUMBER > (((B.X - A.X) * (C.Y - A.Y)) - ((B.Y - A.Y) * (C.X - A.X))) &&
+
+		// Don't fail because of degenerate points
+		(A - B).SizeSquared() > SMALL_NUMBER &&
+		(A - C).SizeSquared() > SMALL_NUMBER &&
+		(C - A).SizeSquared() > SMALL_NUMBER)
+	{
+		return false;
+	}
+
+	for (int32 PointIndex = 0; PointIndex < PointCount; ++PointIndex)
+	{
+		if ((PointIndex == U) || (PointIndex == V) || (PointIndex == W))
+		{
+			continue;
+		}
+
+		// Hole bridges visit the same vertex twice
+		const int32 VertexIndex = VertexIndices[PointIndex];
+		if (VertexIndex == VertexIndices[U] || VertexIndex == VertexIndices[V] || VertexIndex == VertexIndices[W])
+		{
+			continue;
+		}
+
+		if (IsPointInsideTriangle(A, B, C, Polygon[VertexIndex]))
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
@@ -73,6 +73,33 @@ struct FVectorShapeMeshSection
 			Normals.Num() != 0 &&
 			VertexColors.Num() != 0;
 	}
+
+	/** Writes the section arrays as raw blocks rather than tagged properties. Falls back to tagged properties for older packages. */
+	bool Serialize(FArchive& Ar);
+
+	/** Serializes the section arrays, zlib compressed when saving with bCompress. */
+	void SerializeBulkData(FArchive& Ar, bool bCompress);
+
+	/** Removes the degenerate triangles padding spline ranges, and the vertices no triangle uses anymore. */
+	void Compact();
+};
+
+template<>
+struct TStructOpsTypeTraits<FVectorShapeMeshSection> : public TStructOpsTypeTraitsBase2<FVectorShapeMeshSection>
+{
+	enum
+	{
+		WithSerializer = true,
+	};
+};
+
+/** Vertex and index range of a mesh section, rewritten in place without resizing the section. */
+struct FVectorShapeMeshSectionRange
+{
+	int32 FirstVertex;
+	int32 NumVertices;
+	int32 FirstIndex;
+	int32 NumIndices;
 };
 
 /**
@@ -123,8 +150,26 @@ public:
 
 	void ClearMeshSections(bool bMarkDirty);
 
+	/** Replaces every section at once, used to swap in a mesh built off the game thread. */
+	void SetMeshSections(TArray<FVectorShapeMeshSection>&& InMeshSections);
+
 	void MarkMeshDirty();
 
+	/**
+	 *	Replaces the vertices, colors and indices of one section and sends them to the render thread.
+	 *	The scene proxy buffers are updated in place when the new data fits in them, otherwise the render state is recreated.
+	 */
+	void UpdateMeshSection(int32 SectionIndex, const TArray<FVector>& Vertices, const TArray<FColor>& VertexColors, const TArray<uint32>& Indices);
+
+	/** Sends the current data of one section to the render thread, updating the scene proxy buffers in place when possible. */
+	void MarkMeshSectionDirty(int32 SectionIndex);
+
+	/**
+	 *	Sends only the given ranges of one section to the render thread, which locks and rewrites just those parts of the scene proxy buffers.
+	 *	The section must have kept the size the scene proxy was created with, otherwise the render state is recreated.
+	 */
+	void MarkMeshSectionRangesDirty(int32 SectionIndex, const TArray<FVectorShapeMeshSectionRange>& Ranges);
+
 private:
 	//~ Begin USceneComponent Interface.
 	virtual FBoxSphereBounds CalcBounds(const FTransform& LocalToWorld) const override;
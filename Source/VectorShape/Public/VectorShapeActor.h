@@ -22,6 +22,71 @@ class VECTORSHAPE_API AVectorShapeActor : public AActor
 		UPROPERTY(Category = "Vector Shape", EditAnywhere, BlueprintReadOnly)
 		FVector2D WorldSize;
 
+	UPROPERTY(Category = "Vector Shape Mesh", EditAnywhere)
+		bool bDrawMesh;
+
+	UPROPERTY(Category = "Vector Shape Mesh", EditAnywhere, meta = (ClampMin = "1.0", UIMin = "1.0"))
+		float LineDefaultWidth;
+	
+	/** Shape Simplification & Optimization	**/
+	UPROPERTY(Category = "Vector Shape Mesh", EditAnywhere, meta = (EditCondition = "SimplificationMethod == EVectorSimplificationMethod::TangentDirection", ClampMin = "0.0", UIMin = "0.0", ClampMax = "1.0", UIMax = "1.0"))
+		float SimplificationThreshold;
+
+	UPROPERTY(Category = "Vector Shape Mesh", EditAnywhere)
+		EVectorSimplificationMethod SimplificationMethod;
+
+	/** Maximum distance, in shape units, between the simplified outline and the spline curve. */
+	UPROPERTY(Category = "Vector Shape Mesh", EditAnywhere, meta = (EditCondition = "SimplificationMethod == EVectorSimplificationMethod::DouglasPeucker", ClampMin = "0.0", UIMin = "0.0", UIMax = "10.0"))
+		float SimplificationTolerance;
+
+	/** Subdivides curved segments according to their curvature instead of sampling them in fixed steps. */
+	UPROPERTY(Category = "Vector Shape Mesh", EditAnywhere)
+		bool bAdaptiveFlattening;
+
+	/** Maximum distance, in shape units, between a curved segment and the chords it is flattened into. */
+	UPROPERTY(Category = "Vector Shape Mesh", EditAnywhere, meta = (EditCondition = "bAdaptiveFlattening", ClampMin = "0.01", UIMin = "0.01", UIMax = "10.0"))
+		float FlatteningTolerance;
+
+	UPROPERTY(Category = "Vector Shape Mesh", EditAnywhere)
+		bool bUseFixedStepsPerSegment;
+
+	/** If bFilterDrivenBones is specified, only these bones will be modified by this node */
+	UPROPERTY(Category = "Vector Shape Mesh", EditAnywhere, meta = (EditCondition = "bUseFixedStepsPerSegment", ClampMin = "1", UIMin = "1", ClampMax = "100", UIMax = "100"))
+		int32 StepsPerSegment;
+
+	/** Algorithm used to triangulate polygon splines. */
+	UPROPERTY(Category = "Vector Shape Mesh", EditAnywhere)
+		EVectorTriangulationMethod TriangulationMethod;
+
+	/** Regions filled when a polygon spline crosses itself. */
+	UPROPERTY(Category = "Vector Shape Mesh", EditAnywhere)
+		EVectorFillRule FillRule;
+
+	/** Cuts out of polygon splines the parts covered by opaque polygon splines drawn over them with the same material slot, so overlapping splines are not overdrawn. */
+	UPROPERTY(Category = "Vector Shape Mesh", EditAnywhere)
+		bool bRemoveHiddenGeometry;
+
+	/** Keeps the vector splines in cooked builds, so the mesh can be rebuilt at runtime after they are modified. */
+	UPROPERTY(Category = "Vector Shape Mesh", EditAnywhere)
+		bool bRebuildAtRuntime;
+
+	/** Builds the mesh on a background task, the current mesh stays visible until the new one is swapped in. */
+	UPROPERTY(Category = "Vector Shape Mesh", EditAnywhere)
+		bool bBuildAsync;
+
+	/** Splines spliced into each mesh section by the last build, in draw order. */
+	TArray<TArray<TWeakObjectPtr<class UVectorSplineComponent>>> MeshSplineLayout;
+
+	/** Background mesh build in flight, if any. */
+	TSharedPtr<class FVectorShapeAsyncMeshBuild, ESPMode::ThreadSafe> AsyncMeshBuild;
+
+	/** Triangulation failures of the last mesh build. */
+	FVectorShapeMeshBuildReport LastMeshBuildReport;
+
+	/** Set when a rebuild was requested while a background build was in flight. */
+	bool bAsyncMeshBuildPending;
+	bool bAsyncMeshBuildPendingPreview;
+
 #if WITH_EDITORONLY_DATA
 
 	UPROPERTY(Category = "Vector Shape Slate Data", EditAnywhere)
@@ -46,23 +111,6 @@ class VECTORSHAPE_API AVectorShapeActor : public AActor
 	UPROPERTY(EditAnywhere, Category = "Vector Spline")
 		FColor SplineDefaultColor;
 
-	UPROPERTY(Category = "Vector Shape Mesh", EditAnywhere)
-		bool bDrawMesh;
-
-	UPROPERTY(Category = "Vector Shape Mesh", EditAnywhere, meta = (ClampMin = "1.0", UIMin = "1.0"))
-		float LineDefaultWidth;
-	
-	/** Shape Simplification & Optimization	**/
-	UPROPERTY(Category = "Vector Shape Mesh", EditAnywhere, meta = (ClampMin = "0.0", UIMin = "0.0", ClampMax = "1.0", UIMax = "1.0"))
-		float SimplificationThreshold;
-
-	UPROPERTY(Category = "Vector Shape Mesh", EditAnywhere)
-		bool bUseFixedStepsPerSegment;
-
-	/** If bFilterDrivenBones is specified, only these bones will be modified by this node */
-	UPROPERTY(Category = "Vector Shape Mesh", EditAnywhere, meta = (EditCondition = "bUseFixedStepsPerSegment", ClampMin = "1", UIMin = "1", ClampMax = "100", UIMax = "100"))
-		int32 StepsPerSegment;
-
 #endif //WITH_EDITORONLY_DATA
 
 
@@ -77,12 +125,21 @@ public:
 	FORCEINLINE  UVectorMeshComponent* GetMeshComponent() const { return MeshComponent; }
 
 	virtual void OnConstruction(const FTransform& Transform) override;
+	virtual void BeginDestroy() override;
 
 #if WITH_EDITOR
 	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
-	void RebuildVectorShapeMesh();
 #endif //WITH_EDITOR
 
+	/** Rebuilds the vector mesh from the vector splines, only the splines that changed since the last build are regenerated. */
+	UFUNCTION(BlueprintCallable, Category = "Vector Shape")
+		void RebuildVectorShapeMesh();
+
+	/** Rebuilds a coarse preview of the mesh on the next tick, however many times it is requested until then. Used while splines are dragged. */
+	void RequestPreviewMeshRebuild();
+
+	FVectorShapeMeshBuildSettings GetMeshBuildSettings() const;
+
 private:
 	void CheckTransform();
 
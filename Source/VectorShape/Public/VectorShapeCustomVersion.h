@@ -0,0 +1,41 @@
+//==========================================================================//
+// Copyright Elhoussine Mehnik (ue4resources@gmail.com). All Rights Reserved.
+//================== http://unrealengineresources.com/ =====================//
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Misc/Guid.h"
+
+
+/** Custom serialization version of the vector shape assets and components. */
+struct VECTORSHAPE_API FVectorShapeCustomVersion
+{
+	enum Type
+	{
+		// Before any version changes were made in the plugin
+		BeforeCustomVersionWasAdded = 0,
+
+		// Slate vector shape data stores its cooked slate vertices and indices
+		AddedCookedSlateRenderData,
+
+		// Mesh sections and slate vector shape data write their arrays as raw blocks instead of tagged properties
+		BulkSerializedMeshData,
+
+		// -----<new versions can be added above this line>-------------------------------------------------
+		VersionPlusOne,
+		LatestVersion = VersionPlusOne - 1
+	};
+
+	// The GUID for this custom version number
+	const static FGuid GUID;
+
+	/** Non persistent archives (undo buffer, duplication) are always written and read by the running version. */
+	static bool IsAtLeast(const FArchive& Ar, Type Version)
+	{
+		return !Ar.IsPersistent() || Ar.CustomVer(GUID) >= Version;
+	}
+
+private:
+	FVectorShapeCustomVersion() {}
+};
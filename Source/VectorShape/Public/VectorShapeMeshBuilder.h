@@ -0,0 +1,129 @@
+//==========================================================================//
+// Copyright Elhoussine Mehnik (ue4resources@gmail.com). All Rights Reserved.
+//================== http://unrealengineresources.com/ =====================//
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Kismet/BlueprintFunctionLibrary.h"
+#include "VectorShapeTypes.h"
+#include "VectorShapeMeshBuilder.generated.h"
+
+
+class AVectorShapeActor;
+class UVectorSplineComponent;
+class FVectorShapeAsyncMeshBuild;
+struct FVectorSplineMeshCache;
+struct FSplineCurves;
+struct FVectorPolygon;
+
+
+/**
+ * Inputs one spline contributes to a mesh build.
+ * Curves and cache belong to the spline component for game thread builds, and to a snapshot of it for background builds.
+ */
+struct VECTORSHAPE_API FVectorSplineBuildData
+{
+	const FSplineCurves* SplineCurves;
+	FVectorSplineMeshCache* MeshCache;
+	TWeakObjectPtr<UVectorSplineComponent> SplineComponent;
+	FName SplineName;
+	FColor SplineColor;
+	float OffsetZ;
+	EVectorSplineType SplineType;
+	bool bIsHole;
+	EVectorSplineBooleanMode BooleanMode;
+	int32 MaterialSlot;
+
+	FVectorSplineBuildData();
+
+	/** References the curves and mesh cache of the spline component. */
+	explicit FVectorSplineBuildData(UVectorSplineComponent* InSplineComponent);
+
+	FORCEINLINE bool IsHolePolygon() const { return SplineType == EVectorSplineType::Polygon && bIsHole; }
+};
+
+
+/**
+ * Builds vector meshes from vector splines : flattening, simplification, triangulation and stroking.
+ * Available in cooked builds. Spline geometry is cached on each spline and only regenerated when its inputs change.
+ */
+class VECTORSHAPE_API FVectorShapeMeshBuilder
+{
+
+public:
+
+	/**
+	 * Rebuilds the mesh sections of the actor from its vector splines, splicing the splines that changed into the existing sections when possible.
+	 * Preview builds flatten the splines with fewer steps and skip simplification.
+	 */
+	static void BuildVectorShapeMesh(AVectorShapeActor* VectorShapeActor, bool bPreview = false);
+
+	/**
+	 * Snapshots the splines of the actor and builds its mesh on a background task, the current mesh stays visible until the new one is swapped in on the game thread.
+	 * Requests made while a build is in flight are coalesced into a single build started once it finishes.
+	 */
+	static void BuildVectorShapeMeshAsync(AVectorShapeActor* VectorShapeActor, bool bPreview = false);
+
+	/** Queues a preview build of the actor, built once on the next tick however many times it was requested. Full quality builds drop the queued request. */
+	static void RequestPreviewBuild(AVectorShapeActor* VectorShapeActor);
+
+	/** Cancels the background build of the actor, if any, discarding its result. */
+	static void CancelAsyncBuild(AVectorShapeActor* VectorShapeActor);
+
+	/** Flattens the spline curves into a counter clockwise outline, without collinear or duplicated points. */
+	static void FlattenSpline(const FSplineCurves& SplineCurves, const FVectorShapeMeshBuildSettings& Settings, TArray<FVector2D>& OutContour);
+
+	/** Strokes the flattened line of the spline mesh cache into its geometry. The stroke width follows the spline scale. */
+	static void BuildLineGeometry(const FVectorSplineBuildData& Spline, const FVectorShapeMeshBuildSettings& Settings);
+
+	/**
+	 * Triangulates the flattened polygon of the spline mesh cache, with the given hole contours cut out of it, into its geometry.
+	 * When the configured method fails, retries on the cleaned outline, then on its pieces split at self-intersections, then falls back to its convex hull.
+	 * Outlines crossing themselves are split right away, following the fill rule of the settings.
+	 * The outcome is kept in the mesh cache. Returns false if nothing could be triangulated.
+	 */
+	static bool BuildPolygonGeometry(const FVectorSplineBuildData& Spline, const TArray<const TArray<FVector2D>*>& HoleContours, const FVectorShapeMeshBuildSettings& Settings);
+
+	/**
+	 * Triangulates the regions left of a polygon spline once boolean operations were applied to it, into the geometry of its mesh cache.
+	 * The mesh cache keeps the worst outcome among the regions. Returns false if one of them could not be triangulated.
+	 */
+	static bool BuildRegionsGeometry(const FVectorSplineBuildData& Spline, const TArray<FVectorPolygon>& Regions, const FVectorShapeMeshBuildSettings& Settings);
+
+private:
+
+	/**
+	 * Flattens, sorts and builds the geometry of the splines, then groups them by mesh section. Hole splines are cut out of their enclosing polygon.
+	 * Union and subtract splines are merged into or cut out of the polygon layers drawn below them, and are not drawn themselves.
+	 * Polygons the configured triangulation failed on are listed in the report, cached ones included.
+	 */
+	static void BuildSplinesGeometry(TArray<FVectorSplineBuildData>& Splines, const FVectorShapeMeshBuildSettings& Settings, TArray<TArray<FVectorSplineBuildData*>>& OutSectionSplines, FVectorShapeMeshBuildReport& OutReport, TFunctionRef<bool()> IsCancelled);
+
+	static FVectorShapeMeshBuildSettings GetBuildSettings(const AVectorShapeActor* VectorShapeActor, bool bPreview);
+
+	static bool TickPreviewBuilds(float DeltaTime);
+
+	static void FinishAsyncBuild(const TSharedRef<FVectorShapeAsyncMeshBuild, ESPMode::ThreadSafe>& AsyncBuild);
+};
+
+
+UCLASS()
+class VECTORSHAPE_API UVectorShapeMeshBuilderLibrary : public UBlueprintFunctionLibrary
+{
+	GENERATED_BODY()
+
+public:
+
+	/** Rebuilds the vector mesh of the actor from its vector splines. Splines are only cooked if the actor is set to rebuild at runtime. */
+	UFUNCTION(BlueprintCallable, Category = "Vector Shape|Mesh Builder")
+		static void RebuildVectorShapeMesh(AVectorShapeActor* VectorShapeActor);
+
+	/** Flattens a vector spline into a counter clockwise outline, in the local space of its actor. */
+	UFUNCTION(BlueprintCallable, Category = "Vector Shape|Mesh Builder")
+		static void FlattenVectorSpline(const UVectorSplineComponent* SplineComponent, const FVectorShapeMeshBuildSettings& Settings, TArray<FVector2D>& OutContour);
+
+	/** Triangulates a simple polygon. Returns false if the polygon could not be fully triangulated. */
+	UFUNCTION(BlueprintCallable, Category = "Vector Shape|Mesh Builder")
+		static bool TriangulatePolygon(const TArray<FVector2D>& Polygon, EVectorTriangulationMethod Method, TArray<int32>& OutIndices);
+};
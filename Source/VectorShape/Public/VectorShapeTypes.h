@@ -15,7 +15,7 @@ class USlateVectorShapeData;
 
 
 //
-DECLARE_LOG_CATEGORY_EXTERN(LogVectorShape, Log, All);
+VECTORSHAPE_API DECLARE_LOG_CATEGORY_EXTERN(LogVectorShape, Log, All);
 
 //
 DECLARE_STATS_GROUP(TEXT("VectorMesh"), STATGROUP_VectorMesh, STATCAT_Advanced);
@@ -26,9 +26,6 @@ DECLARE_STATS_GROUP(TEXT("VectorWidget"), STATGROUP_VectorWidget, STATCAT_Advanc
 
 struct VECTORSHAPE_API FVectorShapeEditorDelegates
 {
-	DECLARE_MULTICAST_DELEGATE_OneParam(FOnCreateVectorMesh, AVectorShapeActor* /* VectorShapeActor */);
-	static  FOnCreateVectorMesh OnCreateVectorMeshDelegate;
-
 	DECLARE_MULTICAST_DELEGATE_OneParam(FOnVectorDataAssetChanged, USlateVectorShapeData* /* SlateVectorShapeData */);
 	static  FOnVectorDataAssetChanged OnVectorDataAssetChangedDelegate;
 };
@@ -44,6 +41,183 @@ enum class EVectorSplineType : uint8
 };
 
 
+UENUM()
+enum class EVectorTriangulationMethod : uint8
+{
+	/** Ratcliff ear clipping. Robust, but O(n^2) to O(n^3) on large outlines. */
+	EarClipping = 0,
+	/** Sweep-line partition into y-monotone pieces, each triangulated in linear time. O(n log n). */
+	MonotoneSweep = 1,
+	/** Ear clipping testing only the reflex vertices near each ear, found through a uniform grid. Near linear on typical outlines, falls back to plain ear clipping when it stalls. */
+	IndexedEarClipping = 2
+};
+
+
+UENUM()
+enum class EVectorSimplificationMethod : uint8
+{
+	/** Drops the curve steps along which the curve direction barely changes. */
+	TangentDirection = 0,
+	/** Ramer-Douglas-Peucker : drops the curve steps deviating less than the simplification tolerance from the simplified outline. */
+	DouglasPeucker = 1
+};
+
+
+UENUM()
+enum class EVectorFillRule : uint8
+{
+	/** Regions the outline winds around an odd number of times are filled. */
+	EvenOdd = 0,
+	/** Regions the outline winds around at least once, in either direction, are filled. */
+	NonZero = 1
+};
+
+
+UENUM()
+enum class EVectorBooleanOperation : uint8
+{
+	Union = 0,
+	Difference = 1,
+	Intersection = 2
+};
+
+
+UENUM()
+enum class EVectorSplineBooleanMode : uint8
+{
+	/** Drawn as its own layer, over the splines below it. */
+	Layer = 0,
+	/** Merged into the closest polygon layer below it that it overlaps, drawn with the color and material of that layer. */
+	Union = 1,
+	/** Cut out of every polygon layer below it, and not drawn itself. */
+	Subtract = 2
+};
+
+
+UENUM()
+enum class EVectorTriangulationResult : uint8
+{
+	/** Triangulated with the configured method. */
+	Triangulated = 0,
+	/** Triangulated once duplicated, collinear and spike points were removed. */
+	Cleaned = 1,
+	/** Crosses itself, triangulated once split into simple polygons at its self-intersections. */
+	SplitSelfIntersections = 2,
+	/** Replaced by its convex hull, holes are dropped. */
+	ConvexHull = 3,
+	/** Nothing could be triangulated, the spline is not drawn. */
+	Failed = 4
+};
+
+
+/** Point where two edges of a closed polygon cross, edge I going from point I to the next point. */
+struct FPolygonEdgeCrossing
+{
+	int32 EdgeA;
+	int32 EdgeB;
+	FVector2D Point;
+};
+
+
+/** Polygon splines that could not be triangulated as is during a mesh build, crossing themselves or failing the configured method, and how each one was recovered. */
+struct VECTORSHAPE_API FVectorShapeMeshBuildReport
+{
+	struct FTriangulationFailure
+	{
+		FName SplineName;
+		EVectorTriangulationResult Result;
+		/** Seconds spent triangulating the spline, fallbacks included. */
+		double TriangulationTime;
+	};
+
+	TArray<FTriangulationFailure> TriangulationFailures;
+
+	/** Hole splines not strictly inside any polygon spline, left undrawn. */
+	TArray<FName> UnenclosedHoles;
+
+	/** Seconds spent building the spline geometry. */
+	double BuildTime;
+
+	bool bPreview;
+
+	FVectorShapeMeshBuildReport()
+		: BuildTime(0.0)
+		, bPreview(false)
+	{
+	}
+};
+
+
+/** Settings a vector shape mesh is built with. */
+USTRUCT(BlueprintType)
+struct VECTORSHAPE_API FVectorShapeMeshBuildSettings
+{
+	GENERATED_USTRUCT_BODY()
+
+	/** Size of the shape in world units, texture coordinates are normalized by it. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = VectorShapeMeshBuild)
+		FVector2D WorldSize;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = VectorShapeMeshBuild)
+		float LineDefaultWidth;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = VectorShapeMeshBuild)
+		float SimplificationThreshold;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = VectorShapeMeshBuild)
+		EVectorSimplificationMethod SimplificationMethod;
+
+	/** Maximum distance, in shape units, between the simplified outline and the sampled curve. Used by Douglas Peucker simplification. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = VectorShapeMeshBuild)
+		float SimplificationTolerance;
+
+	/** Subdivides curved segments until they deviate less than FlatteningTolerance from their chords, instead of sampling them in fixed steps. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = VectorShapeMeshBuild)
+		bool bAdaptiveFlattening;
+
+	/** Maximum distance, in shape units, between a curved segment and the chords it is flattened into. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = VectorShapeMeshBuild)
+		float FlatteningTolerance;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = VectorShapeMeshBuild)
+		bool bUseFixedStepsPerSegment;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = VectorShapeMeshBuild)
+		int32 StepsPerSegment;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = VectorShapeMeshBuild)
+		EVectorTriangulationMethod TriangulationMethod;
+
+	/** Regions filled when a polygon spline crosses itself. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = VectorShapeMeshBuild)
+		EVectorFillRule FillRule;
+
+	/** Cuts out of polygon splines the parts covered by opaque polygon splines drawn over them with the same material slot. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = VectorShapeMeshBuild)
+		bool bRemoveHiddenGeometry;
+
+	/** Coarse build used while splines are dragged in the editor : every step is kept, nothing is simplified. */
+	bool bPreview;
+
+	FVectorShapeMeshBuildSettings()
+		: WorldSize(100.0f, 100.0f)
+		, LineDefaultWidth(100.0f)
+		, SimplificationThreshold(0.98f)
+		, SimplificationMethod(EVectorSimplificationMethod::TangentDirection)
+		, SimplificationTolerance(0.5f)
+		, bAdaptiveFlattening(false)
+		, FlatteningTolerance(0.25f)
+		, bUseFixedStepsPerSegment(true)
+		, StepsPerSegment(20)
+		, TriangulationMethod(EVectorTriangulationMethod::EarClipping)
+		, FillRule(EVectorFillRule::NonZero)
+		, bRemoveHiddenGeometry(false)
+		, bPreview(false)
+	{
+	}
+};
+
+
 USTRUCT(BlueprintType)
 struct VECTORSHAPE_API FVectorLineData
 {
@@ -12,6 +12,88 @@
 
 class UMaterialInterface;
 
+
+/** Mesh geometry generated from a single vector spline, reused by mesh builds while the spline is unchanged. Never serialized. */
+struct VECTORSHAPE_API FVectorSplineMeshCache
+{
+	/** Hash of the spline data and build settings the contour was flattened from. */
+	uint32 ContourHash;
+
+	/** Hash of everything the geometry was generated from, hole contours included. */
+	uint32 GeometryHash;
+
+	bool bHasContour;
+	bool bHasGeometry;
+
+	/** Set when the geometry was regenerated and still has to be spliced into the mesh section. */
+	bool bGeometryChanged;
+
+	/** Flattened and simplified spline outline. */
+	TArray<FVector2D> Contour;
+
+	/** Crossings between edges of the contour, found along with it for polygon splines. */
+	TArray<FPolygonEdgeCrossing> ContourCrossings;
+
+	/** Bounds of the contour, used to find the splines a boolean operation can affect. */
+	FBox2D ContourBounds;
+
+	/** Unsigned area of the contour, used to find the smallest polygon enclosing a hole. */
+	float ContourArea;
+
+	TArray<FVector> Vertices;
+	TArray<FVector2D> TextureCoordinates;
+	TArray<FColor> VertexColors;
+
+	/** Triangle indices, relative to the first vertex of this spline. */
+	TArray<uint32> Indices;
+
+	FBox LocalBox;
+
+	/** How the polygon was triangulated, and the seconds it took. */
+	EVectorTriangulationResult TriangulationResult;
+	double TriangulationTime;
+
+	/** Vertex and index ranges this spline occupies in the mesh section of its material slot, slack capacity included. */
+	int32 SectionFirstVertex;
+	int32 SectionNumVertices;
+	int32 SectionFirstIndex;
+	int32 SectionNumIndices;
+
+	FVectorSplineMeshCache()
+		: ContourHash(0)
+		, GeometryHash(0)
+		, bHasContour(false)
+		, bHasGeometry(false)
+		, bGeometryChanged(false)
+		, ContourBounds(ForceInit)
+		, ContourArea(0.0f)
+		, LocalBox(ForceInit)
+		, TriangulationResult(EVectorTriangulationResult::Triangulated)
+		, TriangulationTime(0.0)
+		, SectionFirstVertex(INDEX_NONE)
+		, SectionNumVertices(0)
+		, SectionFirstIndex(INDEX_NONE)
+		, SectionNumIndices(0)
+	{
+	}
+
+	void ResetGeometry()
+	{
+		Vertices.Reset();
+		TextureCoordinates.Reset();
+		VertexColors.Reset();
+		Indices.Reset();
+		LocalBox.Init();
+		TriangulationResult = EVectorTriangulationResult::Triangulated;
+		TriangulationTime = 0.0;
+	}
+
+	bool IsPlacedInSection() const
+	{
+		return SectionFirstVertex != INDEX_NONE && Vertices.Num() <= SectionNumVertices && Indices.Num() <= SectionNumIndices;
+	}
+};
+
 /**
  * 
  */
@@ -25,6 +107,9 @@ public:
 #if WITH_EDITOR
 	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
 #endif
+	virtual void PostLoad() override;
+	/** Splines are only cooked when their vector shape actor rebuilds its mesh at runtime. */
+	virtual bool IsEditorOnly() const override;
 	// End of UObject interface
 
 	void InitSpline(const FVector& InLocation, const FVector2D& InExtent, const FColor& InColor, EVectorSplineType InType, bool bDraw);
@@ -44,6 +129,23 @@ public:
 	UPROPERTY()
 		bool bDrawMesh;
 
+	/** If true, this polygon is cut out of the smallest polygon spline enclosing it instead of being filled. */
+	UPROPERTY()
+		bool bIsHole;
+
+	/** How this polygon combines with the polygon splines drawn below it. */
+	UPROPERTY()
+		EVectorSplineBooleanMode BooleanMode;
+
+	/** Material slot of the vector mesh this spline is drawn with. Every slot is built into its own mesh section. */
+	UPROPERTY()
+		int32 MaterialSlot;
+
+	static constexpr int32 MaxMaterialSlots = 16;
+
+	/** Geometry cached by the last mesh build of the owning vector shape actor. */
+	FVectorSplineMeshCache MeshCache;
+
 
 #if WITH_EDITORONLY_DATA
 	/** Color of Additive spline component segment in the editor */
@@ -19,6 +19,7 @@ class UMaterialInstanceDynamic;
 class UMaterialInterface;
 class USlateVectorShapeData;
 struct FSlateBrush;
+struct FSlateVectorShapeRenderData;
 
 
 
@@ -55,19 +56,14 @@ protected:
 	// ~ FGCObject
 	struct FRenderData
 	{
-		/** Holds a copy of the Static Mesh's data converted to a format that Slate understands. */
-		TArray<FSlateVertex> VertexData;
-		/** Connectivity data: Order in which the vertexes occur to make up a series of triangles. */
-		TArray<SlateIndex> IndexData;
+		/** Vertex and index data of the vector asset, shared with every widget drawing the same asset. */
+		TSharedPtr<const FSlateVectorShapeRenderData, ESPMode::ThreadSafe> MeshData;
 		/** Holds on to the material that is found on the StaticMesh. */
 		TSharedPtr<FSlateBrush> Brush;
 		/** A rendering handle used to quickly access the rendering data for the slate element*/
 		FSlateResourceHandle RenderingResourceHandle;
 		
-		bool IsValid() const
-		{
-			return Brush.IsValid() && VertexData.Num() > 0 && IndexData.Num() > 0 ;
-		}
+		bool IsValid() const;
 
 	};
 
@@ -77,4 +73,10 @@ protected:
 	FVector2D CachedWorldSize;
 	TArray<FVectorLineData> LinesData;
 
+	/** Shared vertices transformed by the last painted geometry of this widget, reused while it does not change. */
+	mutable TArray<FSlateVertex> TransformedVertexData;
+	mutable FSlateRenderTransform CachedRenderTransform;
+	mutable FVector2D CachedLocalSize;
+	mutable bool bTransformedVerticesValid;
+
 };
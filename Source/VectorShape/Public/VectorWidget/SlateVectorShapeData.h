@@ -7,6 +7,7 @@
 #include "CoreMinimal.h"
 #include "UObject/ObjectMacros.h"
 #include "UObject/Object.h"
+#include "Rendering/RenderingCommon.h"
 #include "SlateVectorShapeData.generated.h"
 
 class UMaterialInstanceDynamic;
@@ -40,6 +41,11 @@ struct FSlateVectorMeshVertex
 
 	UPROPERTY()
 		uint32 Color;
+
+	friend FArchive& operator<<(FArchive& Ar, FSlateVectorMeshVertex& Vertex)
+	{
+		return Ar << Vertex.Position << Vertex.Color;
+	}
 };
 
 /**
@@ -51,16 +57,34 @@ class VECTORSHAPE_API USlateVectorShapeData : public UObject
 	GENERATED_UCLASS_BODY()
 
 public:
-	/** Access the slate vertexes. */
+	// UObject interface
+	virtual void Serialize(FArchive& Ar) override;
+#if WITH_EDITOR
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
+	// End of UObject interface
+
+	/** Access the slate vertexes. Empty when loaded from a cooked package, which only carries the slate render data. */
 	const TArray<FSlateVectorMeshVertex>& GetVertexData() const;
 	
-	/** Access the indexes for the order in which to draw the vertexes. */
+	/** Access the indexes for the order in which to draw the vertexes. Empty when loaded from a cooked package. */
 	const TArray<uint32>& GetIndexData() const;
 
 	const FVector2D& GetMeshSize() const;
 
 	void InitFromVectorCustomMesh(const FVectorShapeMeshSection* InMeshSection, const FVector2D& InVectorSize);
 
+	/** Incremented whenever the vertex or index data changes, identifies the widget render data built from it. */
+	uint32 GetRenderDataRevision() const;
+
+	/** Slate vertices and indices drawn by vector shape widgets. Copied from the cooked payload if loaded from cooked data, converted from the vertex data otherwise. */
+	void GetSlateRenderData(TArray<FSlateVertex>& OutSlateVerts, TArray<SlateIndex>& OutIndexes) const;
+
+	bool HasCookedSlateRenderData() const;
+
+private:
+	void ConvertToSlateRenderData(TArray<FSlateVertex>& OutSlateVerts, TArray<SlateIndex>& OutIndexes) const;
+
 private:
 	/** @see GetVertexData() */
 	UPROPERTY()
@@ -72,4 +96,11 @@ private:
 
 	UPROPERTY()
 		FVector2D MeshSize;
+
+	/** @see GetRenderDataRevision() */
+	uint32 RenderDataRevision;
+
+	/** Final slate vertex and index layout, only present when loaded from a cooked package. */
+	TArray<FSlateVertex> CookedSlateVertices;
+	TArray<SlateIndex> CookedSlateIndices;
 };
@@ -33,6 +33,7 @@
 #include "VectorShapeEditorHelpers.h"
 #include "VectorSplineComponent.h"
 #include "VectorShapeActor.h"
+#include "VectorShapeMeshBuilder.h"
 
 #include "VectorWidget/SlateVectorShapeData.h"
 
@@ -233,14 +234,42 @@ FReply FVectorMeshComponentDetails::ClickedOnSaveData()
 				bool bDrawMesh = VectorShapeActor->bDrawMesh;
 				const FScopedTransaction Transaction(LOCTEXT("ForceRebuildVectorShapeMesh", "Force Rebuild VectorShape Mesh"));
 
-				if (!bDrawMesh)
+				// The sections are read right away, an async rebuild would still be in flight
+				VectorShapeActor->bDrawMesh = true;
+				FVectorShapeMeshBuilder::BuildVectorShapeMesh(VectorShapeActor);
+
+				// Slate draws the whole shape with one material, merge the sections of every material slot
+				FVectorShapeMeshSection MergedSection;
+				for (int32 SectionIdx = 0; SectionIdx < VectorShapeMeshComp->GetNumSections(); SectionIdx++)
 				{
-					VectorShapeActor->bDrawMesh = true;
-					VectorShapeActor->RebuildVectorShapeMesh();
+					const FVectorShapeMeshSection* MeshSection = VectorShapeMeshComp->GetVectorMeshSection(SectionIdx);
+					if (MeshSection == nullptr || !MeshSection->IsValid())
+					{
+						continue;
+					}
+
+					const uint32 FirstVertex = MergedSection.Vertices.Num();
+					MergedSection.Vertices.Append(MeshSection->Vertices);
+					MergedSection.VertexColors.Append(MeshSection->VertexColors);
+					MergedSection.TextureCoordinates.Append(MeshSection->TextureCoordinates);
+					for (const uint32 Index : MeshSection->Indices)
+					{
+						MergedSection.Indices.Add(FirstVertex + Index);
+					}
+					MergedSection.SectionLocalBox += MeshSection->SectionLocalBox;
+
+					if (MergedSection.Tangents.Num() == 0)
+					{
+						MergedSection.Tangents.Add(FVector::ForwardVector);
+						MergedSection.Normals.Add(FVector::UpVector);
+					}
 				}
 
-				if (FVectorShapeMeshSection* MeshSection = VectorShapeMeshComp->GetVectorMeshSection(0))
+				// Slate keeps the mesh as is, without the slack editor builds leave in the spline ranges
+				MergedSection.Compact();
+
 				{
+					FVectorShapeMeshSection* MeshSection = &MergedSection;
 					if (MeshSection->IsValid())
 					{
 						
@@ -255,7 +284,7 @@ FReply FVectorMeshComponentDetails::ClickedOnSaveData()
 				if (!bDrawMesh)
 				{
 					VectorShapeActor->bDrawMesh = false;
-					VectorShapeActor->RebuildVectorShapeMesh();
+					FVectorShapeMeshBuilder::BuildVectorShapeMesh(VectorShapeActor);
 				}
 			}
 		}
@@ -345,7 +374,7 @@ FReply FVectorMeshComponentDetails::ClickedOnAddNewSplineComponent(bool bIsPolyg
 		if (AVectorShapeActor* VectorShapeActor = Cast<AVectorShapeActor>(VectorShapeMeshComp->GetOwner()))
 		{
 			VectorShapeEditorHelpers::AddNewSplineComponent(VectorShapeActor, bIsPolygon);
-			VectorShapeActor->RebuildVectorShapeMesh();
+			FVectorShapeMeshBuilder::BuildVectorShapeMesh(VectorShapeActor);
 		}
 	}
 
@@ -23,6 +23,7 @@
 #include "CanvasItem.h"
 #include "Widgets/Colors/SColorBlock.h"
 #include "Widgets/Colors/SColorPicker.h"
+#include "Widgets/Input/SSpinBox.h"
 #include "Engine/Engine.h"
 #include "PolygonTools/VectorPolygonTools.h"
 #include "SceneView.h"
@@ -67,6 +68,10 @@ public:
 
 		UI_COMMAND(SetSplineToPolygon, "Polygon", "Set spline shape type to Polygon.", EUserInterfaceActionType::RadioButton, FInputChord(EKeys::Add));
 		UI_COMMAND(SetSplineToLine, "Line", "Set spline shape type to Line.", EUserInterfaceActionType::RadioButton, FInputChord(EKeys::Subtract));
+		UI_COMMAND(ToggleHole, "Hole", "Cut this polygon out of the polygon spline enclosing it.", EUserInterfaceActionType::ToggleButton, FInputChord());
+		UI_COMMAND(SetBooleanModeToLayer, "Layer", "Draw this polygon over the polygon splines below it.", EUserInterfaceActionType::RadioButton, FInputChord());
+		UI_COMMAND(SetBooleanModeToUnion, "Union", "Merge this polygon into the closest polygon spline below it that it overlaps.", EUserInterfaceActionType::RadioButton, FInputChord());
+		UI_COMMAND(SetBooleanModeToSubtract, "Subtract", "Cut this polygon out of every polygon spline below it, without drawing it.", EUserInterfaceActionType::RadioButton, FInputChord());
 		UI_COMMAND(DuplicateSpline, "Duplicate Spline", "Duplicate the currently selected spline component.", EUserInterfaceActionType::Button, FInputChord(EModifierKey::Control, EKeys::W));
 		UI_COMMAND(DeleteSpline, "Delete Spline", "Delete the selected spline component.", EUserInterfaceActionType::Button, FInputChord(EModifierKey::Control, EKeys::Delete));
 		UI_COMMAND(ResetToDefault, "Reset to Default", "Reset this spline to its archetype default.", EUserInterfaceActionType::Button, FInputChord());
@@ -114,6 +119,14 @@ public:
 
 	TSharedPtr<FUICommandInfo> SetSplineToLine;
 
+	TSharedPtr<FUICommandInfo> ToggleHole;
+
+	TSharedPtr<FUICommandInfo> SetBooleanModeToLayer;
+
+	TSharedPtr<FUICommandInfo> SetBooleanModeToUnion;
+
+	TSharedPtr<FUICommandInfo> SetBooleanModeToSubtract;
+
 	TSharedPtr<FUICommandInfo> DrawShape;
 
 	TSharedPtr<FUICommandInfo> ApplyDefaultColor;
@@ -134,6 +147,7 @@ FVectorSplineComponentVisualizer::FVectorSplineComponentVisualizer()
 	, SelectedTangentHandle(INDEX_NONE)
 	, SelectedTangentHandleType(ESelectedTangentHandle::None)
 	, bAllowDuplication(true)
+	, bMeshPreviewed(false)
 	, bAltPressed(false)
 	, bCtrlPressed(false)
 	, bShiftPressed(false)
@@ -191,6 +205,31 @@ void FVectorSplineComponentVisualizer::OnRegister()
 		FIsActionChecked::CreateSP(this, &FVectorSplineComponentVisualizer::IsSplineTypeSet, false));
 
 
+	SplineComponentVisualizerActions->MapAction(
+		Commands.ToggleHole,
+		FExecuteAction::CreateSP(this, &FVectorSplineComponentVisualizer::OnToggleHole),
+		FCanExecuteAction::CreateSP(this, &FVectorSplineComponentVisualizer::CanToggleHole),
+		FIsActionChecked::CreateSP(this, &FVectorSplineComponentVisualizer::IsHole));
+
+	SplineComponentVisualizerActions->MapAction(
+		Commands.SetBooleanModeToLayer,
+		FExecuteAction::CreateSP(this, &FVectorSplineComponentVisualizer::OnSetBooleanMode, EVectorSplineBooleanMode::Layer),
+		FCanExecuteAction::CreateSP(this, &FVectorSplineComponentVisualizer::CanSetBooleanMode),
+		FIsActionChecked::CreateSP(this, &FVectorSplineComponentVisualizer::IsBooleanModeSet, EVectorSplineBooleanMode::Layer));
+
+	SplineComponentVisualizerActions->MapAction(
+		Commands.SetBooleanModeToUnion,
+		FExecuteAction::CreateSP(this, &FVectorSplineComponentVisualizer::OnSetBooleanMode, EVectorSplineBooleanMode::Union),
+		FCanExecuteAction::CreateSP(this, &FVectorSplineComponentVisualizer::CanSetBooleanMode),
+		FIsActionChecked::CreateSP(this, &FVectorSplineComponentVisualizer::IsBooleanModeSet, EVectorSplineBooleanMode::Union));
+
+	SplineComponentVisualizerActions->MapAction(
+		Commands.SetBooleanModeToSubtract,
+		FExecuteAction::CreateSP(this, &FVectorSplineComponentVisualizer::OnSetBooleanMode, EVectorSplineBooleanMode::Subtract),
+		FCanExecuteAction::CreateSP(this, &FVectorSplineComponentVisualizer::CanSetBooleanMode),
+		FIsActionChecked::CreateSP(this, &FVectorSplineComponentVisualizer::IsBooleanModeSet, EVectorSplineBooleanMode::Subtract));
+
+
 	SplineComponentVisualizerActions->MapAction(
 		Commands.SetKeyPositionToLinear,
 		FExecuteAction::CreateSP(this, &FVectorSplineComponentVisualizer::OnSetKeyPositionType, CIM_Linear),
@@ -385,7 +424,12 @@ void FVectorSplineComponentVisualizer::DrawVisualization(const UActorComponent*
 		const bool bIsPolygon = (SplineComp->SplineType == EVectorSplineType::Polygon);
 
 		const FColor ReadOnlyColor = FColor(255, 0, 255, 255);
-		const FColor NormalColor = bIsSplineEditable ? FColor(SplineComp->SplineColor) : ReadOnlyColor;
+		FColor NormalColor = bIsSplineEditable ? FColor(SplineComp->SplineColor) : ReadOnlyColor;
+		if (bIsSplineEditable && bIsPolygon && SplineComp->BooleanMode != EVectorSplineBooleanMode::Layer)
+		{
+			// Union and subtract splines are not drawn with their own color
+			NormalColor = (SplineComp->BooleanMode == EVectorSplineBooleanMode::Subtract) ? SplineComp->SubtractiveSplineSegmentColor.ToFColor(true) : SplineComp->AdditiveSplineSegmentColor.ToFColor(true);
+		}
 		const FColor SelectedColor = bIsSplineEditable ? FColor(SplineComp->SelectionColor.ToFColor(true)) : ReadOnlyColor;
 		const float GrabHandleSize = 12.0f;
 		const float TangentHandleSize = 10.0f;
@@ -496,6 +540,30 @@ void FVectorSplineComponentVisualizer::DrawVisualization(const UActorComponent*
 			OldKeyScale = NewKeyScale;
 		}
 
+		// Crossing outline edges, as found by the last mesh build
+		if (bIsPolygon && SplineComp->MeshCache.ContourCrossings.Num() > 0)
+		{
+			const FColor CrossingColor = FColor(255, 32, 32, 255);
+			const FTransform& SplineTransform = SplineComp->GetComponentTransform();
+			const TArray<FVector2D>& Contour = SplineComp->MeshCache.Contour;
+			const int32 NumContourPoints = Contour.Num();
+
+			auto GetContourLocation = [&](const FVector2D& Point)
+			{
+				return SplineTransform.TransformPosition(FVector(Point.X, Point.Y, 0.0f)) + PositionOffset;
+			};
+
+			for (const FPolygonEdgeCrossing& Crossing : SplineComp->MeshCache.ContourCrossings)
+			{
+				if (Crossing.EdgeB < NumContourPoints)
+				{
+					PDI->DrawLine(GetContourLocation(Contour[Crossing.EdgeA]), GetContourLocation(Contour[(Crossing.EdgeA + 1) % NumContourPoints]), CrossingColor, SDPG_Foreground, 2.0f);
+					PDI->DrawLine(GetContourLocation(Contour[Crossing.EdgeB]), GetContourLocation(Contour[(Crossing.EdgeB + 1) % NumContourPoints]), CrossingColor, SDPG_Foreground, 2.0f);
+					PDI->DrawPoint(GetContourLocation(Crossing.Point), CrossingColor, GrabHandleSize, SDPG_Foreground);
+				}
+			}
+		}
+
 		if (SplineComp == EditedSplineComp)
 		{
 			const FVector VectorShapeLocation = SplineComp->GetComponentLocation();
@@ -1123,7 +1191,9 @@ bool FVectorSplineComponentVisualizer::HandleInputDelta(FEditorViewportClient* V
 			SplineComp->UpdateSpline();
 			SplineComp->bSplineHasBeenEdited = true;
 
-			NotifyPropertyModified(SplineComp, SplineCurvesProperty);
+			// Only previewed while dragging, rebuilt at full quality on release
+			NotifyPropertyModified(SplineComp, SplineCurvesProperty, EPropertyChangeType::Interactive);
+			bMeshPreviewed = true;
 			return true;
 		}
 	}
@@ -1167,6 +1237,8 @@ bool FVectorSplineComponentVisualizer::HandleInputKey(FEditorViewportClient* Vie
 
 		// Reset duplication flag on LMB release
 		bAllowDuplication = true;
+
+		EndMeshPreview();
 	}
 
 	if (Event == IE_Pressed)
@@ -1179,6 +1251,8 @@ bool FVectorSplineComponentVisualizer::HandleInputKey(FEditorViewportClient* Vie
 
 void FVectorSplineComponentVisualizer::EndEditing()
 {
+	EndMeshPreview();
+
 	SplineOwningActor = NULL;
 	SplinePropertyPath.Reset();
 	ChangeSelectionState(INDEX_NONE, false);
@@ -1188,6 +1262,21 @@ void FVectorSplineComponentVisualizer::EndEditing()
 	SelectedSegment = FIntPoint::NoneValue;
 }
 
+void FVectorSplineComponentVisualizer::EndMeshPreview()
+{
+	if (!bMeshPreviewed)
+	{
+		return;
+	}
+
+	bMeshPreviewed = false;
+
+	if (UVectorSplineComponent* SplineComp = GetEditedSplineComponent())
+	{
+		NotifyPropertyModified(SplineComp, SplineCurvesProperty);
+	}
+}
+
 void FVectorSplineComponentVisualizer::ForceRefreshViewports() const
 {
 	GEditor->RedrawLevelEditingViewports(true);
@@ -1683,6 +1772,82 @@ bool FVectorSplineComponentVisualizer::IsSplineTypeSet(bool bIsAdditive) const
 	return false;
 }
 
+void FVectorSplineComponentVisualizer::OnToggleHole()
+{
+	UVectorSplineComponent* SplineComp = GetEditedSplineComponent();
+	if (SplineComp != nullptr)
+	{
+		const FScopedTransaction Transaction(LOCTEXT("OnToggleHole", "Toggle Hole"));
+
+		SplineComp->Modify();
+		if (SplineOwningActor.IsValid())
+		{
+			SplineOwningActor.Get()->Modify();
+		}
+
+		SplineComp->bIsHole = !SplineComp->bIsHole;
+
+		SplineComp->PostEditChange();
+		ForceRefreshViewports();
+	}
+}
+
+bool FVectorSplineComponentVisualizer::CanToggleHole() const
+{
+	if (const UVectorSplineComponent* SplineComp = GetEditedSplineComponent())
+	{
+		return SplineComp->SplineType == EVectorSplineType::Polygon;
+	}
+	return false;
+}
+
+bool FVectorSplineComponentVisualizer::IsHole() const
+{
+	if (const UVectorSplineComponent* SplineComp = GetEditedSplineComponent())
+	{
+		return SplineComp->bIsHole;
+	}
+	return false;
+}
+
+void FVectorSplineComponentVisualizer::OnSetBooleanMode(EVectorSplineBooleanMode BooleanMode)
+{
+	UVectorSplineComponent* SplineComp = GetEditedSplineComponent();
+	if (SplineComp != nullptr)
+	{
+		const FScopedTransaction Transaction(LOCTEXT("SetBooleanMode", "Set Boolean Mode"));
+
+		SplineComp->Modify();
+		if (SplineOwningActor.IsValid())
+		{
+			SplineOwningActor.Get()->Modify();
+		}
+
+		SplineComp->BooleanMode = BooleanMode;
+
+		SplineComp->PostEditChange();
+		ForceRefreshViewports();
+	}
+}
+
+bool FVectorSplineComponentVisualizer::CanSetBooleanMode() const
+{
+	if (const UVectorSplineComponent* SplineComp = GetEditedSplineComponent())
+	{
+		return SplineComp->SplineType == EVectorSplineType::Polygon;
+	}
+	return false;
+}
+
+bool FVectorSplineComponentVisualizer::IsBooleanModeSet(EVectorSplineBooleanMode BooleanMode) const
+{
+	if (const UVectorSplineComponent* SplineComp = GetEditedSplineComponent())
+	{
+		return SplineComp->BooleanMode == BooleanMode;
+	}
+	return false;
+}
+
 void FVectorSplineComponentVisualizer::OnDeleteSplineComponent()
 {
 	if (UVectorSplineComponent* SplineComp = GetEditedSplineComponent())
@@ -1842,6 +2007,16 @@ TSharedPtr<SWidget> FVectorSplineComponentVisualizer::GenerateContextMenu() cons
 					FSlateIcon(FVectorShapeEditorStyle::GetAppStyleSetName(), "VectorShapeEditor.SplineType")
 				);
 
+				MenuBuilder.AddMenuEntry(FVectorSplineComponentVisualizerCommands::Get().ToggleHole);
+
+				MenuBuilder.AddSubMenu(
+					LOCTEXT("BooleanMode", "Boolean Mode"),
+					LOCTEXT("BooleanModeTooltip", "Define how this polygon combines with the polygon splines below it."),
+					FNewMenuDelegate::CreateSP(this, &FVectorSplineComponentVisualizer::GenerateBooleanModeSubMenu),
+					false,
+					FSlateIcon()
+				);
+
 				MenuBuilder.AddMenuEntry(FVectorSplineComponentVisualizerCommands::Get().DeleteSpline);
 				MenuBuilder.AddMenuEntry(FVectorSplineComponentVisualizerCommands::Get().DuplicateSpline);
 			}
@@ -1854,6 +2029,7 @@ TSharedPtr<SWidget> FVectorSplineComponentVisualizer::GenerateContextMenu() cons
 			MenuBuilder.AddMenuEntry(FVectorSplineComponentVisualizerCommands::Get().DrawShape);
 			MenuBuilder.AddWidget(CreateColorSelectionWidegt()->AsShared(), /*LOCTEXT("VertexColor", "Color"))*/FText::GetEmpty());
 			MenuBuilder.AddMenuEntry(FVectorSplineComponentVisualizerCommands::Get().ApplyDefaultColor);
+			MenuBuilder.AddWidget(CreateMaterialSlotWidget()->AsShared(), LOCTEXT("MaterialSlot", "Material Slot"));
 		}
 		MenuBuilder.EndSection();
 
@@ -1884,6 +2060,13 @@ void FVectorSplineComponentVisualizer::GenerateSplineTypeSubMenu(FMenuBuilder& M
 	MenuBuilder.AddMenuEntry(FVectorSplineComponentVisualizerCommands::Get().SetSplineToLine);
 }
 
+void FVectorSplineComponentVisualizer::GenerateBooleanModeSubMenu(FMenuBuilder& MenuBuilder) const
+{
+	MenuBuilder.AddMenuEntry(FVectorSplineComponentVisualizerCommands::Get().SetBooleanModeToLayer);
+	MenuBuilder.AddMenuEntry(FVectorSplineComponentVisualizerCommands::Get().SetBooleanModeToUnion);
+	MenuBuilder.AddMenuEntry(FVectorSplineComponentVisualizerCommands::Get().SetBooleanModeToSubtract);
+}
+
 
 TSharedPtr<SWidget> FVectorSplineComponentVisualizer::CreateColorSelectionWidegt() const
 {
@@ -1895,6 +2078,41 @@ TSharedPtr<SWidget> FVectorSplineComponentVisualizer::CreateColorSelectionWidegt
 		.Size(FVector2D(35.0f, 12.0f));
 }
 
+TSharedPtr<SWidget> FVectorSplineComponentVisualizer::CreateMaterialSlotWidget() const
+{
+	return SNew(SSpinBox<int32>)
+		.MinValue(0)
+		.MaxValue(UVectorSplineComponent::MaxMaterialSlots - 1)
+		.MinDesiredWidth(50.0f)
+		.ToolTipText(LOCTEXT("MaterialSlotTooltip", "Material slot of the vector mesh used to draw this spline."))
+		.Value(this, &FVectorSplineComponentVisualizer::GetMaterialSlot)
+		.OnValueCommitted(this, &FVectorSplineComponentVisualizer::OnMaterialSlotCommitted);
+}
+
+int32 FVectorSplineComponentVisualizer::GetMaterialSlot() const
+{
+	if (UVectorSplineComponent* SplineComp = GetEditedSplineComponent())
+	{
+		return SplineComp->MaterialSlot;
+	}
+	return 0;
+}
+
+void FVectorSplineComponentVisualizer::OnMaterialSlotCommitted(int32 NewMaterialSlot, ETextCommit::Type CommitType) const
+{
+	UVectorSplineComponent* SplineComp = GetEditedSplineComponent();
+	if (SplineComp != nullptr && SplineComp->MaterialSlot != NewMaterialSlot)
+	{
+		const FScopedTransaction Transaction(LOCTEXT("SetMaterialSlot", "Set Material Slot"));
+
+		SplineComp->Modify();
+		SplineComp->MaterialSlot = NewMaterialSlot;
+
+		SplineComp->PostEditChange();
+		ForceRefreshViewports();
+	}
+}
+
 FLinearColor FVectorSplineComponentVisualizer::OnGetColorForColorBlock() const
 {
 	if (UVectorSplineComponent* SplineComp = GetEditedSplineComponent())
@@ -20,6 +20,7 @@ class FViewport;
 class SWidget;
 class UVectorSplineComponent;
 struct FViewportClick;
+enum class EVectorSplineBooleanMode : uint8;
 
 /** Base class for clickable spline editing proxies */
 struct HVectorSplineVisProxy : public HComponentVisProxy
@@ -96,6 +97,9 @@ public:
 
 	void ForceRefreshViewports() const;
 
+	/** Rebuilds the mesh at full quality if it was previewed during a drag */
+	void EndMeshPreview();
+
 	/** Get the spline component we are currently editing */
 	UVectorSplineComponent* GetEditedSplineComponent() const;
 
@@ -139,6 +143,14 @@ protected:
 	void OnSetSplineType(bool bIsAdditive);
 	bool IsSplineTypeSet(bool bIsAdditive) const;
 
+	void OnToggleHole();
+	bool CanToggleHole() const;
+	bool IsHole() const;
+
+	void OnSetBooleanMode(EVectorSplineBooleanMode BooleanMode);
+	bool CanSetBooleanMode() const;
+	bool IsBooleanModeSet(EVectorSplineBooleanMode BooleanMode) const;
+
 	void OnDeleteSplineComponent();
 
 	void OnDuplicateSplineComponent();
@@ -158,9 +170,17 @@ protected:
 
 	void GenerateSplineTypeSubMenu(FMenuBuilder& MenuBuilder) const;
 
+	void GenerateBooleanModeSubMenu(FMenuBuilder& MenuBuilder) const;
+
 
 	TSharedPtr<SWidget> CreateColorSelectionWidegt() const;
 
+	TSharedPtr<SWidget> CreateMaterialSlotWidget() const;
+
+	int32 GetMaterialSlot() const;
+
+	void OnMaterialSlotCommitted(int32 NewMaterialSlot, ETextCommit::Type CommitType) const;
+
 	/**
 	* @return The color that should be displayed in the color block
 	*/
@@ -236,6 +256,9 @@ protected:
 	/** Whether we currently allow duplication when dragging */
 	bool bAllowDuplication;
 
+	/** Whether the mesh was only previewed since the drag started, and needs a full quality rebuild once it ends */
+	bool bMeshPreviewed;
+
 	private:
 
 		bool bAltPressed;
@@ -13,12 +13,9 @@
 #include "Kismet2/ComponentEditorUtils.h"
 
 #include "VectorMeshComponent.h"
-#include "VectorShapeEditorTypes.h"
 
 #include "VectorShapeTypes.h"
 
-#include "PolygonTools/VectorPolygonTools.h"
-
 
 #define LOCTEXT_NAMESPACE "VectorShapeEditorHelpers"
 
@@ -204,185 +201,6 @@ void VectorShapeEditorHelpers::ClearAllSplineComponents(AVectorShapeActor* Vecto
 	FComponentEditorUtils::DeleteComponents(SplineComps, ComponentToSelect);
 }
 
-// Dont forget Transaction when you add multi comps
-void VectorShapeEditorHelpers::OnCreateVectorMesh(AVectorShapeActor* VectorShapeActor)
-{
-	if (!IsValid(VectorShapeActor) || VectorShapeActor->IsUnreachable())
-	{
-		return;
-	}
-
-	UVectorMeshComponent* VectorMeshComp = VectorShapeActor->GetMeshComponent();
-	{
-		VectorMeshComp->ClearMeshSections(false);
-	}
-
-
-	if (VectorShapeActor->bDrawMesh)
-	{
-		// Generate Polygon
-		TArray<FVectorShapePolygon> SplinesSimplifiedPolygons;
-
-		{
-			TArray<UActorComponent*> SplineComps;
-			VectorShapeActor->GetComponents(UVectorSplineComponent::StaticClass(), SplineComps);
-			SplinesSimplifiedPolygons.Reset(SplineComps.Num() * 4);
-			for (auto* SplineComp : SplineComps)
-			{
-				if (UVectorSplineComponent* Spline2DComponent = Cast<UVectorSplineComponent>(SplineComp))
-				{
-
-					if (!Spline2DComponent->bDrawMesh)
-					{
-						continue;
-					}
-
-					{
-						Spline2DComponent->CheckSpline();
-					}
-
-					{
-						FVectorShapePolygon& NewPolygon = *new (SplinesSimplifiedPolygons) FVectorShapePolygon(Spline2DComponent);
-						FPolygonTools::SimplifySplinePolygon(NewPolygon);
-						FPolygonTools::RemoveCollinearPoints(NewPolygon.Vertices2D);
-						FPolygonTools::RemoveDuplicatedPoints(NewPolygon.Vertices2D);
-					}
-				}
-			}
-		}
-
-		//
-		{
-			const int32 NumPolygons = SplinesSimplifiedPolygons.Num();
-			for (int32 a = 0; a < NumPolygons; a++)
-			{
-				for (int32 b = 0; b < NumPolygons; b++)
-				{
-					const float& PolyADepth = SplinesSimplifiedPolygons[a].SplineComponent->OffsetZ;
-					const float& PolyBDepth = SplinesSimplifiedPolygons[b].SplineComponent->OffsetZ;
-					if (PolyADepth < PolyBDepth)
-					{
-						// Swap the order in which polygons will be drawn
-						SplinesSimplifiedPolygons.Swap(a, b);
-					}
-				}
-			}
-		}
-
-
-		{
-			const float& LineWidth = VectorShapeActor->LineDefaultWidth;
-			const FVector2D& WorldSize = VectorShapeActor->WorldSize;
-
-			VectorMeshComp->InitMeshSections(1);
-			FVectorShapeMeshSection* MeshSection = VectorMeshComp->GetVectorMeshSection(0);
-
-
-			int32 RunningIndex = 0;
-
-			FVector2D Norm(ForceInitToZero);
-
-			for (FVectorShapePolygon Polygon : SplinesSimplifiedPolygons)
-			{
-				const FColor& VertexColor = Polygon.SplineComponent->SplineColor;
-				const float& OffsetZ = Polygon.SplineComponent->OffsetZ;
-
-				if (Polygon.SplineComponent->SplineType == EVectorSplineType::Line)
-				{
-					const int32 NumVerts = Polygon.Vertices2D.Num();
-					for (int32 VertIdx = 0; VertIdx < NumVerts; VertIdx++)
-					{
-						const FVector2D& P1 = Polygon.Vertices2D[VertIdx];
-						const FVector2D& P2 = (VertIdx == NumVerts - 1) ? Polygon.Vertices2D[VertIdx - 1] : Polygon.Vertices2D[VertIdx + 1];
-
-						const FVector2D Dir = (VertIdx == NumVerts - 1) ? (P1 - P2) : (P2 - P1);
-						
-
-						 if (VertIdx > 0 && VertIdx < NumVerts - 1)
-						 {
-							 const FVector2D& P0 = Polygon.Vertices2D[VertIdx - 1];
-							 const FVector2D Dir2 = (P1 - P0);
-							 Norm = ((FVector2D(Dir.Y, -Dir.X).GetSafeNormal() + FVector2D(Dir2.Y, -Dir2.X).GetSafeNormal()) / 2.0f).GetSafeNormal();
-						 }
-						 else
-						 {
-							  Norm = FVector2D(Dir.Y, -Dir.X).GetSafeNormal();
-						 }
-
-						const float S0 = Polygon.SplineComponent->FindScaleClosestToWorldLocation(VectorShapeActor->GetActorTransform().TransformPosition(FVector(P1, 0))).Y;
-
-						const FVector V0 = FVector(P1 + Norm * LineWidth * S0, OffsetZ);
-						const FVector V1 = FVector(P1 - Norm * LineWidth * S0, OffsetZ);
-
-						MeshSection->Vertices.Add(V0);
-						MeshSection->Vertices.Add(V1);
-
-						MeshSection->VertexColors.Add(VertexColor);
-						MeshSection->VertexColors.Add(VertexColor);
-
-						MeshSection->TextureCoordinates.Add(FVector2D(V0.X, V0.Y) / WorldSize);
-						MeshSection->TextureCoordinates.Add(FVector2D(V1.X, V1.Y) / WorldSize);
-
-						MeshSection->SectionLocalBox += V0;
-						MeshSection->SectionLocalBox += V1;
-
-						RunningIndex += 2;
-
-						if (VertIdx < NumVerts - 1)
-						{
-							const int32 T0 = RunningIndex - 2;
-							const int32 T1 = RunningIndex - 1;
-							const int32 T2 = T0 + 2;
-							const int32 T3 = T0 + 3;
-
-							MeshSection->Indices.Add(T0);
-							MeshSection->Indices.Add(T1);
-							MeshSection->Indices.Add(T3);
-
-							MeshSection->Indices.Add(T3);
-							MeshSection->Indices.Add(T2);
-							MeshSection->Indices.Add(T0);
-						}
-					}
-				}
-				else
-				{
-
-					FPolygonTools::TriangulatePolygon(Polygon.Vertices2D, MeshSection->Indices, RunningIndex, false);
-
-
-
-					for (const FVector2D& Vertex2D : Polygon.Vertices2D)
-					{
-						const FVector Vertex3D = FVector(Vertex2D.X, Vertex2D.Y, OffsetZ);
-						MeshSection->Vertices.Add(Vertex3D);
-						MeshSection->VertexColors.Add(VertexColor);
-						MeshSection->TextureCoordinates.Add(Vertex2D / WorldSize);
-						MeshSection->SectionLocalBox += Vertex3D;
-					}
-
-					RunningIndex += Polygon.Vertices2D.Num();
-				}
-			}
-
-
-			if (RunningIndex != 0)
-			{
-				MeshSection->Tangents.Add(FVector::ForwardVector);
-				MeshSection->Normals.Add(FVector::UpVector);
-
-				if (MeshSection->TextureCoordinates.Num() == 0)
-					MeshSection->TextureCoordinates.Add(FVector2D(1.f, 1.f));
-
-			}
-			VectorMeshComp->SetMaterial(0, FVectorShapeRuntimeHelpers::GetVectorMeshDefaultMaterial());
-		}
-	}
-
-	// Finalize Mesh
-	VectorMeshComp->MarkMeshDirty();
-}
-
 
 
 
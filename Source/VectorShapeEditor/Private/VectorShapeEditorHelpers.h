@@ -9,7 +9,6 @@
 
 class UVectorSplineComponent;
 class AVectorShapeActor;
-struct FVectorShapePolygon;
 
 
 
@@ -19,5 +18,4 @@ namespace VectorShapeEditorHelpers
 	UVectorSplineComponent* DuplicateSplineComponent(UVectorSplineComponent* SplineComponent);
 	void RemoveSplineComponent(UVectorSplineComponent* SplineComponent);
 	void ClearAllSplineComponents(AVectorShapeActor* VectorShapeActor);
-	void OnCreateVectorMesh(AVectorShapeActor* VectorShapeActor);
 }
\ No newline at end of file
@@ -73,11 +73,6 @@ void FVectorShapeEditorModule::StartupModule()
 		}
 	}
 
-	//
-	{
-		FVectorShapeEditorDelegates::OnCreateVectorMeshDelegate.AddRaw(this, &FVectorShapeEditorModule::OnCreateVectorShapeMesh);
-	}
-
 	//
 	{
 		FPropertyEditorModule& PropertyModule = FModuleManager::LoadModuleChecked<FPropertyEditorModule>("PropertyEditor");
@@ -105,10 +100,6 @@ void FVectorShapeEditorModule::ShutdownModule()
 
 		}
 
-		
-		{
-			FVectorShapeEditorDelegates::OnCreateVectorMeshDelegate.RemoveAll(this);
-		}
 
 		{
 			if (FModuleManager::Get().IsModuleLoaded("AssetTools"))
@@ -131,10 +122,6 @@ void FVectorShapeEditorModule::ShutdownModule()
 	}
 }
 
-void FVectorShapeEditorModule::OnCreateVectorShapeMesh(AVectorShapeActor* VectorShapeActor)
-{
-	VectorShapeEditorHelpers::OnCreateVectorMesh(VectorShapeActor);
-}
 
 
 
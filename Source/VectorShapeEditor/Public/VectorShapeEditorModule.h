@@ -7,7 +7,6 @@
 #include "CoreMinimal.h"
 #include "Modules/ModuleManager.h"
 #include "Async/AsyncWork.h"
-#include "VectorShapeEditorTypes.h"
 
 
 
@@ -28,7 +27,4 @@ public:
 protected:
 	TArray< TSharedPtr<IAssetTypeActions> > CreatedAssetTypeActions;
 
-private:
-	void OnCreateVectorShapeMesh(AVectorShapeActor* VectorShapeActor);
-
 };